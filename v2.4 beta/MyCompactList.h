@@ -0,0 +1,373 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#pragma once
+#ifndef MyCompactList_H
+#define MyCompactList_H
+#include "MyCompactListAllocator.h"				//  32- 
+#include <utility>								// std::forward
+#include <iterator>
+#include <initializer_list>
+#include <type_traits>
+#ifndef CONTAINER_VERIFY
+#ifdef _STL_VERIFY
+#define CONTAINER_VERIFY(cond, what) _STL_VERIFY(cond, what)
+#else
+#include <cassert>
+#define CONTAINER_VERIFY(cond, what) assert((cond) && what)
+#endif
+#endif
+
+template <class T>
+class MyCompactList {														//   32- :  -     .
+public:																		// T = int   12   24  MyLinkedList.   2^32 - 2 
+	using value_type = T;
+	using size_type = size_t;
+	using difference_type = std::ptrdiff_t;
+	using reference = value_type&;
+	using const_reference = const value_type&;
+	using pointer = value_type*;
+	using const_pointer = const value_type*;
+	class iterator;
+	class const_iterator;
+	using reverse_iterator = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+private:
+	struct BaseNode;
+	struct Node;
+	using Allocator = MyCompactListAllocator<Node>;
+	using index_type = typename Allocator::index_type;
+	static constexpr index_type end_index{ 0 };								// -    
+private:
+	Allocator alc;															//     
+	size_t my_size;
+public:
+	inline MyCompactList() noexcept : MyCompactList(MyPageSource::default_source()) {}
+	inline explicit MyCompactList(MyPageSource* page_source) noexcept : alc{ page_source }, my_size{ 0 } {}
+	inline MyCompactList(const std::initializer_list<T>& init) : MyCompactList() { append_range(init); }
+	template <class InputIt> inline MyCompactList(InputIt first, InputIt last) : MyCompactList() { insert(end(), first, last); }
+	inline MyCompactList(const MyCompactList& o) : MyCompactList(o.alc.page_source()) { append_range(o); }
+	inline MyCompactList(MyCompactList&& o) noexcept : alc{ std::move(o.alc) }, my_size{ o.my_size } { o.my_size = 0; }	//      
+	inline MyCompactList& operator=(const MyCompactList& o) { if (this != &o) { MyCompactList copy{ o }; swap(copy); } return *this; }
+	inline MyCompactList& operator=(MyCompactList&& o) noexcept { if (this != &o) { destroy_nodes(); alc = std::move(o.alc); my_size = o.my_size; o.my_size = 0; } return *this; }
+	inline ~MyCompactList() noexcept { destroy_nodes(); }
+public:
+	inline size_t size() const noexcept { return my_size; }
+	inline bool empty() const noexcept { return my_size == 0; }
+	inline bool isEmpty() const noexcept { return my_size == 0; }
+	static constexpr size_t max_size() noexcept { return Allocator::no_block - 1; }	//   
+	inline MyListAllocatorStatistics allocator_statistics() const noexcept { return alc.statistics(); }
+	inline MyPageSource* page_source() const noexcept { return alc.page_source(); }
+	inline void reserve(size_t count) { prepare(); if (count > my_size) alc.reserve(count - my_size); }	//    -   
+	inline void swap(MyCompactList& o) noexcept { std::swap(alc, o.alc); std::swap(my_size, o.my_size); }
+public:
+	template<class ...Types> inline void emplace_back(Types&&... Args) { prepare(); emplace_helper(node(end_index)->p, end_index, std::forward<Types>(Args)...); }
+	template<class ...Types> inline void emplace_front(Types&&... Args) { prepare(); emplace_helper(end_index, node(end_index)->n, std::forward<Types>(Args)...); }
+	inline void push_back(T&& val) { emplace_back(std::move(val)); }
+	inline void push_front(T&& val) { emplace_front(std::move(val)); }
+	inline void push_back(const T& val) { emplace_back(val); }
+	inline void push_front(const T& val) { emplace_front(val); }
+	inline void append(T&& val) { emplace_back(std::move(val)); }
+	inline void prepend(T&& val) { emplace_front(std::move(val)); }
+	inline void append(const T& val) { emplace_back(val); }
+	inline void prepend(const T& val) { emplace_front(val); }
+	template<class Range> void append_range(const Range& range);			//   size()   
+
+	void pop_back() noexcept;
+	void pop_front() noexcept;
+	inline void removeFirst() noexcept { pop_front(); }
+	inline void removeLast() noexcept { pop_back(); }
+
+	template<class ...Types> iterator emplace(const_iterator before, Types&&... Args);
+	inline iterator insert(const_iterator before, T&& val) { return emplace(before, std::move(val)); }
+	inline iterator insert(const_iterator before, const T& val) { return emplace(before, val); }
+	template<class InputIt> iterator insert(const_iterator before, InputIt first, InputIt last);
+
+	iterator erase(const_iterator pos) noexcept;
+	iterator erase(const_iterator first, const_iterator last) noexcept;
+	void clear() noexcept;
+public:
+	inline T& front() noexcept { CONTAINER_VERIFY(!(empty()), "Empty list"); return node(node(end_index)->n)->val; }
+	inline T& first() noexcept { return front(); }
+	inline T& back() noexcept { CONTAINER_VERIFY(!(empty()), "Empty list"); return node(node(end_index)->p)->val; }
+	inline T& last() noexcept { return back(); }
+	inline const T& front() const noexcept { CONTAINER_VERIFY(!(empty()), "Empty list"); return node(node(end_index)->n)->val; }
+	inline const T& first() const noexcept { return front(); }
+	inline const T& back() const noexcept { CONTAINER_VERIFY(!(empty()), "Empty list"); return node(node(end_index)->p)->val; }
+	inline const T& last() const noexcept { return back(); }
+public:
+	bool contains(const T& val) const noexcept;
+	size_t count(const T& val) const noexcept;
+	template<class Predicate> size_t remove_if(Predicate pred);
+	inline size_t remove(const T& val) { return remove_if([&val](const T& elem) { return elem == val; }); }
+	void reverse() noexcept;												//    ,   
+	bool operator==(const MyCompactList& o) const noexcept;
+	inline bool operator!=(const MyCompactList& o) const noexcept { return !(*this == o); }
+public:																		//     : begin() == end() ==  
+	inline iterator begin() noexcept { return alc.empty() ? iterator() : iterator(&alc, node(node(end_index)->n)); }
+	inline iterator end() noexcept { return alc.empty() ? iterator() : iterator(&alc, node(end_index)); }
+	inline const_iterator begin() const noexcept { return alc.empty() ? const_iterator() : const_iterator(&alc, node(node(end_index)->n)); }
+	inline const_iterator end() const noexcept { return alc.empty() ? const_iterator() : const_iterator(&alc, node(end_index)); }
+	inline const_iterator cbegin() const noexcept { return begin(); }
+	inline const_iterator cend() const noexcept { return end(); }
+	inline reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+	inline reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+	inline const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+	inline const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+	inline const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+	inline const_reverse_iterator crend() const noexcept { return rend(); }
+	inline const MyCompactList& as_const() const noexcept { return *this; }
+private:
+	inline Node* node(index_type index) const noexcept { return alc.at(index); }
+	inline index_type index_of(const Node* target) const noexcept { return node(target->p)->n; }	//    
+	inline void prepare() { if (alc.empty()) create_base_node(); }
+	void create_base_node();
+	template<class ...Types> index_type emplace_helper(index_type prev, index_type next, Types&&... Args);	//  :     
+	void displace_helper(index_type target) noexcept;
+	void destroy_nodes() noexcept;
+	template <class Range> static inline auto range_count(const Range& range, int) -> decltype(static_cast<size_t>(std::size(range))) { return std::size(range); }
+	template <class Range> static inline size_t range_count(const Range&, long) { return 0; }
+public:
+	class iterator {														// -     .       
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = MyCompactList::value_type;
+		using difference_type = ptrdiff_t;
+		using pointer = MyCompactList::pointer;
+		using reference = MyCompactList::reference;
+	private:
+		friend class MyCompactList;
+		const Allocator* my_alc;
+		Node* my_node;
+		typename Allocator::Window my_window;
+		inline iterator(const Allocator* alc, Node* node) noexcept : my_alc{ alc }, my_node{ node }, my_window{} {}
+	public:
+		inline iterator() noexcept : my_alc{ nullptr }, my_node{ nullptr }, my_window{} {}
+		inline iterator& operator++() noexcept { my_node = my_alc->at(my_node->n, my_window); return *this; }
+		inline iterator& operator--() noexcept { my_node = my_alc->at(my_node->p, my_window); return *this; }
+		inline iterator operator++(int) noexcept { iterator it{ *this }; ++(*this); return it; }
+		inline iterator operator--(int) noexcept { iterator it{ *this }; --(*this); return it; }
+		inline bool operator==(const iterator& o) const noexcept { return my_node == o.my_node; }
+		inline bool operator!=(const iterator& o) const noexcept { return my_node != o.my_node; }
+		inline T& operator*() const noexcept { CONTAINER_VERIFY(my_node && my_node != my_alc->at(end_index), "Can't dereference end iterator"); return my_node->val; }
+		inline T* operator->() const noexcept { return std::addressof(**this); }
+	};
+
+	class const_iterator {
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = MyCompactList::value_type;
+		using difference_type = ptrdiff_t;
+		using pointer = MyCompactList::const_pointer;
+		using reference = MyCompactList::const_reference;
+	private:
+		friend class MyCompactList;
+		const Allocator* my_alc;
+		const Node* my_node;
+		typename Allocator::Window my_window;
+		inline const_iterator(const Allocator* alc, const Node* node) noexcept : my_alc{ alc }, my_node{ node }, my_window{} {}
+	public:
+		inline const_iterator() noexcept : my_alc{ nullptr }, my_node{ nullptr }, my_window{} {}
+		inline const_iterator(const iterator& it) noexcept : my_alc{ it.my_alc }, my_node{ it.my_node }, my_window{ it.my_window } {}
+		inline const_iterator& operator++() noexcept { my_node = my_alc->at(my_node->n, my_window); return *this; }
+		inline const_iterator& operator--() noexcept { my_node = my_alc->at(my_node->p, my_window); return *this; }
+		inline const_iterator operator++(int) noexcept { const_iterator it{ *this }; ++(*this); return it; }
+		inline const_iterator operator--(int) noexcept { const_iterator it{ *this }; --(*this); return it; }
+		inline bool operator==(const const_iterator& o) const noexcept { return my_node == o.my_node; }
+		inline bool operator!=(const const_iterator& o) const noexcept { return my_node != o.my_node; }
+		inline const T& operator*() const noexcept { CONTAINER_VERIFY(my_node && my_node != my_alc->at(end_index), "Can't dereference end iterator"); return my_node->val; }
+		inline const T* operator->() const noexcept { return std::addressof(**this); }
+	};
+private:
+	struct BaseNode {														//   .    -    64- 
+		index_type p, n;
+	};
+	struct Node : public BaseNode {
+		T val;
+		template<class ...Types>
+		inline Node(index_type prev, index_type next, Types&&... Args) : BaseNode{ prev, next }, val(std::forward<Types>(Args)...) {}
+		inline Node(const Node&) = delete;
+		inline Node& operator=(const Node&) = delete;
+		inline ~Node() = default;
+	};
+};
+
+template <class T>
+void MyCompactList<T>::create_base_node() {
+	index_type base{ alc.allocate() };
+	CONTAINER_VERIFY(base == end_index, "Sentinel must be the first block");
+	new (node(base)) BaseNode{ end_index, end_index };
+}
+
+template <class T>
+template <class ...Types>
+typename MyCompactList<T>::index_type MyCompactList<T>::emplace_helper(index_type prev, index_type next, Types&&... Args) {
+	CONTAINER_VERIFY(my_size < max_size(), "Too many elements for 32-bit links");
+	index_type block{ alc.allocate() };
+	try
+	{
+		new (node(block)) Node(prev, next, std::forward<Types>(Args)...);
+	}
+	catch (...)
+	{
+		alc.deallocate(block);
+		throw;
+	}
+	node(prev)->n = block;
+	node(next)->p = block;
+	++my_size;
+	return block;
+}
+
+template <class T>
+void MyCompactList<T>::displace_helper(index_type target) noexcept {
+	Node* removed{ node(target) };
+	node(removed->p)->n = removed->n;
+	node(removed->n)->p = removed->p;
+	removed->~Node();
+	alc.deallocate(target);
+	--my_size;
+}
+
+template <class T>
+void MyCompactList<T>::destroy_nodes() noexcept {
+	if constexpr (!std::is_trivially_destructible<T>::value)
+		if (!alc.empty())
+		{
+			typename Allocator::Window window;
+			for (index_type index = node(end_index)->n, next; index != end_index; index = next)
+			{
+				Node* target{ alc.at(index, window) };
+				next = target->n;
+				target->~Node();
+			}
+		}
+}
+
+template <class T>
+template <class Range>
+void MyCompactList<T>::append_range(const Range& range) {
+	reserve(my_size + range_count(range, 0));
+	for (const auto& val : range)
+		emplace_back(val);
+}
+
+template <class T>
+void MyCompactList<T>::pop_back() noexcept {
+	CONTAINER_VERIFY(!(empty()), "Empty list");
+	displace_helper(node(end_index)->p);
+}
+
+template <class T>
+void MyCompactList<T>::pop_front() noexcept {
+	CONTAINER_VERIFY(!(empty()), "Empty list");
+	displace_helper(node(end_index)->n);
+}
+
+template <class T>
+template <class ...Types>
+typename MyCompactList<T>::iterator MyCompactList<T>::emplace(const_iterator before, Types&&... Args) {
+	prepare();
+	index_type next{ before.my_node ? index_of(before.my_node) : end_index };	//  - end()   
+	index_type block{ emplace_helper(node(next)->p, next, std::forward<Types>(Args)...) };
+	return iterator(&alc, node(block));
+}
+
+template <class T>
+template <class InputIt>
+typename MyCompactList<T>::iterator MyCompactList<T>::insert(const_iterator before, InputIt first, InputIt last) {
+	prepare();
+	index_type next{ before.my_node ? index_of(before.my_node) : end_index };
+	index_type prev{ node(next)->p };
+	if constexpr (std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>::value)
+		alc.reserve(static_cast<size_t>(std::distance(first, last)));
+	for (; first != last; ++first)
+		emplace_helper(node(next)->p, next, *first);
+	return iterator(&alc, node(node(prev)->n));								//   before,    
+}
+
+template <class T>
+typename MyCompactList<T>::iterator MyCompactList<T>::erase(const_iterator pos) noexcept {
+	CONTAINER_VERIFY(pos.my_node && pos.my_node != node(end_index), "Can't erase end iterator");
+	index_type next{ pos.my_node->n };
+	displace_helper(index_of(pos.my_node));
+	return iterator(&alc, node(next));
+}
+
+template <class T>
+typename MyCompactList<T>::iterator MyCompactList<T>::erase(const_iterator first, const_iterator last) noexcept {
+	while (first != last)
+		first = erase(first);
+	return iterator(&alc, const_cast<Node*>(last.my_node));
+}
+
+template <class T>
+void MyCompactList<T>::clear() noexcept {
+	if (alc.empty())
+		return;
+	destroy_nodes();
+	alc.clear();															//   -     0
+	create_base_node();
+	my_size = 0;
+}
+
+template <class T>
+bool MyCompactList<T>::contains(const T& val) const noexcept {
+	for (const T& elem : *this)
+		if (elem == val)
+			return true;
+	return false;
+}
+
+template <class T>
+size_t MyCompactList<T>::count(const T& val) const noexcept {
+	size_t found{ 0 };
+	for (const T& elem : *this)
+		found += elem == val;
+	return found;
+}
+
+template <class T>
+template <class Predicate>
+size_t MyCompactList<T>::remove_if(Predicate pred) {
+	size_t removed{ 0 };
+	if (alc.empty())
+		return removed;
+	typename Allocator::Window window;
+	for (index_type index = node(end_index)->n, next; index != end_index; index = next)
+	{
+		Node* current{ alc.at(index, window) };
+		next = current->n;
+		if (pred(static_cast<const T&>(current->val)))
+		{
+			displace_helper(index);
+			++removed;
+		}
+	}
+	return removed;
+}
+
+template <class T>
+void MyCompactList<T>::reverse() noexcept {
+	if (alc.empty())
+		return;
+	index_type index{ end_index };
+	do
+	{
+		BaseNode* current{ node(index) };
+		std::swap(current->p, current->n);
+		index = current->p;													// 
+	} while (index != end_index);
+}
+
+template <class T>
+bool MyCompactList<T>::operator==(const MyCompactList& o) const noexcept {
+	if (my_size != o.my_size)
+		return false;
+	const_iterator mine{ begin() }, other{ o.begin() };
+	for (size_t i = 0; i < my_size; ++i, ++mine, ++other)
+		if (!(*mine == *other))
+			return false;
+	return true;
+}
+#endif	//MyCompactList_H
@@ -0,0 +1,229 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#pragma once
+#ifndef MyCompactListAllocator_H
+#define MyCompactListAllocator_H
+#include "MyPageSource.h"						//  
+#include "MyListStatistics.h"					//   (MYLIST_STATISTICS)
+#include <cstdint>
+#include <new>									// std::bad_alloc
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>								// _BitScanReverse64
+#endif
+#ifndef ALLOCATOR_VERIFY
+#ifdef _STL_VERIFY
+#define ALLOCATOR_VERIFY(cond, what) _STL_VERIFY(cond, what)
+#else
+#include <cassert>
+#define ALLOCATOR_VERIFY(cond, what) assert((cond) && what)
+#endif
+#endif
+
+template<class T>
+class MyCompactListAllocator {											//  32-   .  k  first_page_blocks << k ,
+public:																	//      :    ,  -   
+	using byte = unsigned char;
+	using value_type = T;
+	using index_type = std::uint32_t;
+	static constexpr index_type no_block{ ~index_type{ 0 } };			//   .  -   no_block
+private:
+	struct FreeBlock {													//  : ,    -   4 
+		index_type prev;
+	};
+	static constexpr unsigned first_page_shift{ 5 };
+	static constexpr size_t first_page_blocks{ size_t{ 1 } << first_page_shift };
+	static constexpr size_t max_pages{ sizeof(index_type) * 8 - first_page_shift + 1 };	//    
+private:
+	MyPageSource* source;												//  : new[], std::pmr, mmap  
+#ifdef MYLIST_STATISTICS
+	struct Counters {
+		size_t free_blocks{ 0 }, reserve_calls{ 0 }, pages_allocated{ 0 }, pages_released{ 0 };
+	} counters;
+#endif
+	byte* pages[max_pages];												// .   :   
+	size_t page_count;
+	size_t next_block;													//       
+	index_type ftop;													//     
+	size_t used_blocks;
+public:
+	inline explicit MyCompactListAllocator(MyPageSource* page_source = MyPageSource::default_source()) noexcept
+		: source{ page_source }, pages{}, page_count{ 0 }, next_block{ 0 }, ftop{ no_block }, used_blocks{ 0 }
+	{ static_assert(sizeof(FreeBlock) <= sizeof(T), "Block must hold a free-chain index"); }
+	MyCompactListAllocator(const MyCompactListAllocator&) = delete;
+	MyCompactListAllocator& operator=(const MyCompactListAllocator&) = delete;
+	MyCompactListAllocator(MyCompactListAllocator&& o) noexcept;
+	MyCompactListAllocator& operator=(MyCompactListAllocator&& o) noexcept;
+	inline ~MyCompactListAllocator() noexcept { release_pages(0); }
+public:
+	index_type allocate();												//    
+	void deallocate(index_type block) noexcept;
+	inline T* at(index_type block) const noexcept						//,       
+	{ size_t page{ floor_log2((size_t{ block } >> first_page_shift) + 1) }; return reinterpret_cast<T*>(pages[page] + (block - page_first_block(page)) * sizeof(T)); }
+	struct Window {														// ,    .       ,
+		size_t first{ 0 }, count{ 0 };									//   -     
+		byte* page{ nullptr };
+	};
+	inline T* at(index_type block, Window& window) const noexcept {
+		size_t slot{ block - window.first };							//      slot
+		if (slot >= window.count)
+		{
+			size_t page{ floor_log2((size_t{ block } >> first_page_shift) + 1) };
+			window.first = page_first_block(page);
+			window.count = first_page_blocks << page;
+			window.page = pages[page];
+			slot = block - window.first;
+		}
+		return reinterpret_cast<T*>(window.page + slot * sizeof(T));
+	}
+	void reserve(size_t val_count);										//  val_count  
+	void clear() noexcept;												//  ,  .     
+	inline bool empty() const noexcept { return page_count == 0; }		//   -   
+	inline MyPageSource* page_source() const noexcept { return source; }
+	MyListAllocatorStatistics statistics() const noexcept;				// MYLIST_STATISTICS      
+private:
+	static inline size_t page_first_block(size_t page) noexcept { return ((size_t{ 1 } << page) - 1) << first_page_shift; }
+	static inline size_t page_bytes(size_t page) noexcept { return (first_page_blocks << page) * sizeof(T); }	//T        
+	static inline size_t floor_log2(size_t val) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+		return sizeof(unsigned long long) * 8 - 1 - static_cast<size_t>(__builtin_clzll(val));
+#elif defined(_MSC_VER) && defined(_M_X64)
+		unsigned long bit;
+		_BitScanReverse64(&bit, val);
+		return bit;
+#else
+		size_t bit{ 0 };
+		while (val >>= 1)
+			++bit;
+		return bit;
+#endif
+	}
+	void allocate_page();
+	void release_pages(size_t kept) noexcept;							//     kept
+};
+
+template<class T>
+MyCompactListAllocator<T>::MyCompactListAllocator(MyCompactListAllocator&& o) noexcept
+	: source{ o.source }, pages{}, page_count{ o.page_count }, next_block{ o.next_block }, ftop{ o.ftop }, used_blocks{ o.used_blocks } {
+	for (size_t page = 0; page < page_count; ++page)
+		pages[page] = o.pages[page];
+	o.page_count = 0;
+	o.next_block = 0;
+	o.ftop = no_block;
+	o.used_blocks = 0;
+	MYLIST_STAT(counters = o.counters; o.counters = Counters();)
+}
+
+template<class T>
+MyCompactListAllocator<T>& MyCompactListAllocator<T>::operator=(MyCompactListAllocator&& o) noexcept {
+	if (this != &o)
+	{
+		release_pages(0);
+		source = o.source;
+		page_count = o.page_count;
+		for (size_t page = 0; page < page_count; ++page)
+			pages[page] = o.pages[page];
+		next_block = o.next_block;
+		ftop = o.ftop;
+		used_blocks = o.used_blocks;
+		o.page_count = 0;
+		o.next_block = 0;
+		o.ftop = no_block;
+		o.used_blocks = 0;
+		MYLIST_STAT(counters = o.counters; o.counters = Counters();)
+	}
+	return *this;
+}
+
+template<class T>
+void MyCompactListAllocator<T>::allocate_page() {
+	if (page_count == max_pages || page_first_block(page_count) >= no_block)	//    
+		throw std::bad_alloc();
+	size_t bytes{ page_bytes(page_count) };
+	pages[page_count] = static_cast<byte*>(source->allocate_page(bytes));
+	MYLIST_STAT(
+		++counters.pages_allocated;
+		MyListStatistics::page_allocated(pages[page_count], bytes);
+	)
+	++page_count;
+}
+
+template<class T>
+void MyCompactListAllocator<T>::release_pages(size_t kept) noexcept {
+	while (page_count > kept)
+	{
+		--page_count;
+		MYLIST_STAT(
+			++counters.pages_released;
+			MyListStatistics::page_released(pages[page_count], page_bytes(page_count));
+		)
+		source->deallocate_page(pages[page_count], page_bytes(page_count));
+	}
+}
+
+template<class T>
+typename MyCompactListAllocator<T>::index_type MyCompactListAllocator<T>::allocate() {
+	if (ftop != no_block)												//  -  
+	{
+		index_type block{ ftop };
+		ftop = reinterpret_cast<FreeBlock*>(at(block))->prev;
+		MYLIST_STAT(--counters.free_blocks;)
+		++used_blocks;
+		return block;
+	}
+	if (next_block == page_first_block(page_count))						//  -    
+	{
+		if (next_block >= no_block)
+			throw std::bad_alloc();
+		allocate_page();
+	}
+	++used_blocks;
+	return static_cast<index_type>(next_block++);
+}
+
+template<class T>
+void MyCompactListAllocator<T>::deallocate(index_type block) noexcept {
+	if (block + size_t{ 1 } == next_block)								//     
+		--next_block;
+	else
+	{
+		new (at(block)) FreeBlock{ ftop };
+		ftop = block;
+		MYLIST_STAT(++counters.free_blocks;)
+	}
+	--used_blocks;
+}
+
+template<class T>
+void MyCompactListAllocator<T>::reserve(size_t val_count) {
+	MYLIST_STAT(++counters.reserve_calls;)
+	ALLOCATOR_VERIFY(next_block + val_count <= no_block, "Too many blocks for 32-bit indices");
+	while (page_first_block(page_count) - next_block < val_count)
+		allocate_page();
+}
+
+template<class T>
+void MyCompactListAllocator<T>::clear() noexcept {
+	release_pages(page_count ? 1 : 0);
+	next_block = 0;
+	ftop = no_block;
+	used_blocks = 0;
+	MYLIST_STAT(counters.free_blocks = 0;)
+}
+
+template<class T>
+MyListAllocatorStatistics MyCompactListAllocator<T>::statistics() const noexcept {
+	MyListAllocatorStatistics stats{};
+	stats.pages = page_count;
+	stats.bytes_reserved = page_first_block(page_count) * sizeof(T);	//   :    
+	stats.allocated_blocks = page_first_block(page_count);
+	stats.used_blocks = used_blocks;
+#ifdef MYLIST_STATISTICS
+	stats.free_blocks = counters.free_blocks;
+	stats.reserve_calls = counters.reserve_calls;
+	stats.pages_allocated = counters.pages_allocated;
+	stats.pages_released = counters.pages_released;
+#endif
+	return stats;
+}
+#endif	//MyCompactListAllocator_H
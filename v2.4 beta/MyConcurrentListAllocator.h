@@ -0,0 +1,294 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#pragma once
+#ifndef MyConcurrentListAllocator_H
+#define MyConcurrentListAllocator_H
+#include "MyListAllocator.h"
+#include "MyPageSource.h"
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+template<class T>
+class MyConcurrentListAllocator {										//  MyListAllocator       
+public:
+	using byte = unsigned char;
+	using value_type = T;
+private:
+	struct MemoryPage {													//  
+		inline MemoryPage(size_t bytes_count, MemoryPage* link = nullptr) : offset{ 0 }, size{ bytes_count }, prev{ link } {}
+		size_t offset;													//offset  size -  
+		size_t size;
+		MemoryPage* prev;
+	};
+	struct FreeBlock {													//    
+		FreeBlock* prev;
+	};
+	struct FreeBatch : FreeBlock {										//  ,    
+		FreeBatch* next;
+		size_t count;
+	};
+	struct Pool {														// . ,   
+		inline Pool(size_t block_bytes, MyPageSource* page_source) : block_size{ block_bytes }, id{ ++last_id }, source{ page_source }, top{ nullptr }, base{ nullptr }, batches{ nullptr }, generation{ 0 }, allocated_blocks{ 0 } {}
+		~Pool();
+		const size_t block_size;
+		const unsigned long long id;									//   ,    
+		MyPageSource* const source;
+		std::mutex page_mutex;											//       
+		MemoryPage* top, * base;
+		std::atomic<FreeBatch*> batches;								//Lock-free    
+		std::atomic<size_t> generation;									//  clear() -      
+		size_t allocated_blocks;
+		static std::atomic<unsigned long long> last_id;
+	};
+	struct ThreadCache {												//       
+		std::weak_ptr<Pool> pool;
+		unsigned long long id;
+		size_t generation;
+		FreeBlock* head;
+		size_t count;
+	};
+	struct CacheRegistry {												//      .      
+		std::vector<ThreadCache> caches;
+		ThreadCache* last{ nullptr };
+		~CacheRegistry();
+	};
+private:
+	static const size_t batch_size;										// ,      
+	static const double reserve_multiplier;
+	static const size_t min_allocated_blocks;
+private:
+	std::shared_ptr<Pool> pool;
+	std::atomic<bool> base_taken;										//   -     ( ).  
+																		//     
+public:
+	explicit MyConcurrentListAllocator(MyPageSource* page_source = MyPageSource::default_source());
+	MyConcurrentListAllocator(const MyConcurrentListAllocator&) = delete;
+	MyConcurrentListAllocator& operator=(const MyConcurrentListAllocator&) = delete;
+	inline MyConcurrentListAllocator(MyConcurrentListAllocator&& o) noexcept : pool{ std::move(o.pool) }, base_taken{ o.base_taken.load(std::memory_order_relaxed) } {}
+	inline MyConcurrentListAllocator& operator=(MyConcurrentListAllocator&& o) noexcept
+	{ if (this != &o) { pool = std::move(o.pool); base_taken.store(o.base_taken.load(std::memory_order_relaxed), std::memory_order_relaxed); } return *this; }
+	inline ~MyConcurrentListAllocator() noexcept = default;
+public:
+	T* allocate();														//    
+	void deallocate(T* ptr);											//    ,      ,   
+	void reserve(size_t val_count);										//   val_count 
+	inline MyPageSource* page_source() const noexcept { return pool->source; }
+	void clear();														//     allocate/deallocate
+private:
+	ThreadCache& local_cache();											//     
+	void refill(ThreadCache& cache);									//         
+	void flush(ThreadCache& cache);										//       
+	static void push_batches(Pool& owner, FreeBatch* first, FreeBatch* last) noexcept;
+	static inline MemoryPage* allocate_page(Pool& owner, size_t page_size, MemoryPage* link)
+	{ byte* new_page{ static_cast<byte*>(owner.source->allocate_page(sizeof(MemoryPage) + page_size)) }; return new (reinterpret_cast<MemoryPage*>(new_page)) MemoryPage(page_size, link); }
+	static inline void deallocate_page(Pool& owner, MemoryPage* page) { owner.source->deallocate_page(page, sizeof(MemoryPage) + page->size); }
+	static CacheRegistry& registry() { static thread_local CacheRegistry caches; return caches; }
+};
+
+template<class T>
+const size_t MyConcurrentListAllocator<T>::batch_size{ 64 };
+template<class T>
+const double MyConcurrentListAllocator<T>::reserve_multiplier{ 1 };
+template<class T>
+const size_t MyConcurrentListAllocator<T>::min_allocated_blocks{ 1 };
+template<class T>
+std::atomic<unsigned long long> MyConcurrentListAllocator<T>::Pool::last_id{ 0 };
+
+template<class T>
+MyConcurrentListAllocator<T>::MyConcurrentListAllocator(MyPageSource* page_source)
+	: pool{ std::make_shared<Pool>(sizeof(T), page_source) }, base_taken{ false } {
+	ALLOCATOR_VERIFY(sizeof(FreeBatch) <= sizeof(T), "Size of value can't be less than three pointers (in bytes)");
+	pool->base = allocate_page(*pool, sizeof(T), nullptr);						//    ,   MyListAllocator
+	pool->base->offset = sizeof(T);
+	pool->top = pool->base;
+	pool->allocated_blocks = 1;
+}
+
+template<class T>
+MyConcurrentListAllocator<T>::Pool::~Pool() {
+	while (top)
+	{
+		MemoryPage* page{ top };
+		top = top->prev;
+		deallocate_page(*this, page);
+	}
+}
+
+template<class T>
+MyConcurrentListAllocator<T>::CacheRegistry::~CacheRegistry() {
+	for (ThreadCache& cache : caches)
+		if (cache.head)
+			if (std::shared_ptr<Pool> owner = cache.pool.lock())
+				if (owner->generation.load(std::memory_order_acquire) == cache.generation)
+				{
+					FreeBatch* batch{ reinterpret_cast<FreeBatch*>(cache.head) };	//       
+					batch->count = cache.count;
+					push_batches(*owner, batch, batch);
+				}
+}
+
+template<class T>
+typename MyConcurrentListAllocator<T>::ThreadCache& MyConcurrentListAllocator<T>::local_cache() {
+	CacheRegistry& caches{ registry() };
+	ThreadCache* cache{ caches.last };
+	if (!cache || cache->id != pool->id)
+	{
+		cache = nullptr;
+		for (ThreadCache& entry : caches.caches)
+			if (entry.id == pool->id)
+				cache = &entry;
+		if (!cache)
+		{
+			for (size_t i = 0; i < caches.caches.size();)				//     
+				if (caches.caches[i].pool.expired())
+				{
+					caches.caches[i] = caches.caches.back();
+					caches.caches.pop_back();
+				}
+				else
+					++i;
+			caches.caches.push_back(ThreadCache{ pool, pool->id, pool->generation.load(std::memory_order_acquire), nullptr, 0 });
+			cache = &caches.caches.back();
+		}
+		caches.last = cache;
+	}
+	size_t generation{ pool->generation.load(std::memory_order_acquire) };
+	if (cache->generation != generation)								// clear()      
+	{
+		cache->generation = generation;
+		cache->head = nullptr;
+		cache->count = 0;
+	}
+	return *cache;
+}
+
+template<class T>
+T* MyConcurrentListAllocator<T>::allocate() {
+	if (!base_taken.load(std::memory_order_relaxed) && !base_taken.exchange(true, std::memory_order_relaxed))
+		return reinterpret_cast<T*>(reinterpret_cast<byte*>(pool->base) + sizeof(MemoryPage));
+	ThreadCache& cache{ local_cache() };
+	if (!cache.head)
+		refill(cache);
+	FreeBlock* block{ cache.head };
+	cache.head = block->prev;
+	--cache.count;
+	return reinterpret_cast<T*>(block);
+}
+
+template<class T>
+void MyConcurrentListAllocator<T>::deallocate(T* ptr) {
+	ThreadCache& cache{ local_cache() };
+	FreeBlock* block{ reinterpret_cast<FreeBlock*>(ptr) };
+	block->prev = cache.head;
+	cache.head = block;
+	if (++cache.count >= 2 * batch_size)
+		flush(cache);
+}
+
+template<class T>
+void MyConcurrentListAllocator<T>::refill(ThreadCache& cache) {
+	FreeBatch* taken{ pool->batches.exchange(nullptr, std::memory_order_acquire) };	//    -     ABA
+	if (taken)
+	{
+		FreeBatch* rest{ taken->next };
+		if (rest)
+		{
+			FreeBatch* rest_last{ rest };
+			while (rest_last->next)
+				rest_last = rest_last->next;
+			push_batches(*pool, rest, rest_last);						//   
+		}
+		cache.head = taken;
+		cache.count = taken->count;
+		return;
+	}
+	std::lock_guard<std::mutex> lock{ pool->page_mutex };				// :     
+	MemoryPage* page{ pool->top };
+	if (page->offset == page->size)
+	{
+		size_t new_blocks_count = min_allocated_blocks + static_cast<size_t>(pool->allocated_blocks * reserve_multiplier);
+		page = pool->top = allocate_page(*pool, new_blocks_count * sizeof(T), pool->top);
+		pool->allocated_blocks += new_blocks_count;
+	}
+	size_t count{ std::min(batch_size, (page->size - page->offset) / sizeof(T)) };
+	byte* first{ reinterpret_cast<byte*>(page) + sizeof(MemoryPage) + page->offset };
+	page->offset += count * sizeof(T);
+	FreeBlock* head{ nullptr };
+	for (size_t i = count; i > 0; --i)									//     
+	{
+		FreeBlock* block{ reinterpret_cast<FreeBlock*>(first + (i - 1) * sizeof(T)) };
+		block->prev = head;
+		head = block;
+	}
+	cache.head = head;
+	cache.count = count;
+}
+
+template<class T>
+void MyConcurrentListAllocator<T>::flush(ThreadCache& cache) {
+	FreeBatch* batch{ reinterpret_cast<FreeBatch*>(cache.head) };
+	FreeBlock* batch_last{ cache.head };
+	for (size_t i = 1; i < batch_size; ++i)
+		batch_last = batch_last->prev;
+	cache.head = batch_last->prev;
+	cache.count -= batch_size;
+	batch_last->prev = nullptr;
+	batch->count = batch_size;
+	push_batches(*pool, batch, batch);
+}
+
+template<class T>
+void MyConcurrentListAllocator<T>::push_batches(Pool& owner, FreeBatch* first, FreeBatch* last) noexcept {
+	FreeBatch* expected{ owner.batches.load(std::memory_order_relaxed) };
+	do
+		last->next = expected;
+	while (!owner.batches.compare_exchange_weak(expected, first, std::memory_order_release, std::memory_order_relaxed));
+}
+
+template<class T>
+void MyConcurrentListAllocator<T>::reserve(size_t val_count) {
+	if (val_count > 0)
+	{
+		std::lock_guard<std::mutex> lock{ pool->page_mutex };
+		MemoryPage* page{ pool->top };
+		size_t free_blocks{ (page->size - page->offset) / sizeof(T) };
+		if (free_blocks < val_count)
+		{
+			if (free_blocks)											//         
+			{
+				byte* first{ reinterpret_cast<byte*>(page) + sizeof(MemoryPage) + page->offset };
+				page->offset += free_blocks * sizeof(T);
+				FreeBlock* head{ nullptr };
+				for (size_t i = free_blocks; i > 0; --i)
+				{
+					FreeBlock* block{ reinterpret_cast<FreeBlock*>(first + (i - 1) * sizeof(T)) };
+					block->prev = head;
+					head = block;
+				}
+				FreeBatch* batch{ reinterpret_cast<FreeBatch*>(head) };
+				batch->count = free_blocks;
+				push_batches(*pool, batch, batch);
+			}
+			pool->top = allocate_page(*pool, val_count * sizeof(T), pool->top);
+			pool->allocated_blocks += val_count;
+		}
+	}
+}
+
+template<class T>
+void MyConcurrentListAllocator<T>::clear() {
+	std::lock_guard<std::mutex> lock{ pool->page_mutex };
+	while (pool->top != pool->base)										//  ,  
+	{
+		MemoryPage* page{ pool->top };
+		pool->top = page->prev;
+		deallocate_page(*pool, page);
+	}
+	pool->batches.store(nullptr, std::memory_order_relaxed);
+	pool->allocated_blocks = 1;
+	pool->generation.fetch_add(1, std::memory_order_release);
+}
+#endif	//MyConcurrentListAllocator_H
@@ -0,0 +1,276 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#pragma once
+#ifndef MyConcurrentQueue_H
+#define MyConcurrentQueue_H
+#include "MyConcurrentListAllocator.h"			//     
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <algorithm>							// std::sort  std::binary_search
+#include <new>									// std::bad_alloc
+#include <functional>							// std::hash<std::thread::id>  std::less
+
+template <class T>
+class MyConcurrentQueue {													//Lock-free  -     
+public:
+	using value_type = T;
+	using size_type = size_t;
+	using reference = value_type&;
+	using const_reference = const value_type&;
+private:
+	struct QueueNode;
+	struct HazardRecord;
+	struct RecordBlock;
+	using Allocator = MyConcurrentListAllocator<QueueNode>;
+private:
+	static constexpr size_t block_records{ 128 };							//  .     ,   
+	static constexpr size_t hazards_per_record{ 2 };
+private:
+	Allocator alc;
+	alignas(64) std::atomic<QueueNode*> head;								//head -  ,    head->n
+	alignas(64) std::atomic<QueueNode*> tail;
+	RecordBlock* records;													// .        
+	std::atomic<size_t> record_count;
+public:
+	MyConcurrentQueue();
+	MyConcurrentQueue(const MyConcurrentQueue&) = delete;
+	MyConcurrentQueue& operator=(const MyConcurrentQueue&) = delete;
+	~MyConcurrentQueue() noexcept;
+public:
+	template<class ...Types> void emplace(Types&&... Args);
+	inline void push(const T& val) { emplace(val); }
+	inline void push(T&& val) { emplace(std::move(val)); }
+	inline void enqueue(const T& val) { emplace(val); }
+	inline void enqueue(T&& val) { emplace(std::move(val)); }
+	bool try_pop(T& val);													//false,   
+	inline bool try_dequeue(T& val) { return try_pop(val); }
+	inline bool empty() const noexcept { return !head.load(std::memory_order_acquire)->n.load(std::memory_order_acquire); }	//     
+private:
+	HazardRecord& acquire_record();											//    . std::bad_alloc -     
+	static inline void release_record(HazardRecord& record) noexcept
+	{ for (auto& hazard : record.hazards) hazard.store(nullptr, std::memory_order_release); record.active.store(false, std::memory_order_release); }
+	static QueueNode* protect(std::atomic<QueueNode*>& hazard, const std::atomic<QueueNode*>& source) noexcept;
+	void retire(HazardRecord& record, QueueNode* node) noexcept;			// ,         
+	void scan(HazardRecord& record) noexcept;
+	bool collect_hazards(std::vector<const QueueNode*>& hazards) const noexcept;	//    . false -   
+	bool is_hazard(const QueueNode* node) const noexcept;					//    -      
+	inline size_t retire_threshold() const noexcept { return 2 * record_count.load(std::memory_order_relaxed) * hazards_per_record; }	//   ,    
+private:
+	struct QueueNode {														//    MyLinkedList: p, n, 
+		QueueNode* p;														//     
+		std::atomic<QueueNode*> n;
+		alignas(T) unsigned char storage[sizeof(T)];						//    
+		inline QueueNode() noexcept : p{ nullptr }, n{ nullptr } {}
+		inline T* value() noexcept { return reinterpret_cast<T*>(storage); }
+	};
+	struct alignas(64) HazardRecord {										//    -  
+		std::atomic<bool> active{ false };
+		std::atomic<QueueNode*> hazards[hazards_per_record]{};
+		QueueNode* retired{ nullptr };										//    ,    
+		size_t retired_count{ 0 };
+		std::vector<const QueueNode*> snapshot;								//   scan,    
+	};
+	struct RecordBlock {
+		HazardRecord records[block_records];
+		std::atomic<RecordBlock*> next{ nullptr };
+	};
+};
+
+template <class T>
+MyConcurrentQueue<T>::MyConcurrentQueue() : records{ new RecordBlock() }, record_count{ block_records } {
+	QueueNode* dummy{ new (alc.allocate()) QueueNode() };					//   - ,   my_end  
+	head.store(dummy, std::memory_order_relaxed);
+	tail.store(dummy, std::memory_order_relaxed);
+}
+
+template <class T>
+MyConcurrentQueue<T>::~MyConcurrentQueue() noexcept {						//,       
+	QueueNode* cur{ head.load(std::memory_order_acquire)->n.load(std::memory_order_acquire) };
+	for (; cur; cur = cur->n.load(std::memory_order_relaxed))
+		cur->value()->~T();													//      
+	for (RecordBlock* block = records, *next; block; block = next)
+	{
+		next = block->next.load(std::memory_order_relaxed);
+		delete block;
+	}
+}
+
+template <class T>
+typename MyConcurrentQueue<T>::HazardRecord& MyConcurrentQueue<T>::acquire_record() {
+	size_t start{ std::hash<std::thread::id>()(std::this_thread::get_id()) % block_records };	//      
+	for (RecordBlock* block = records;;)
+	{
+		for (size_t i = 0, index = start; i < block_records; ++i, index = (index + 1) % block_records)
+		{
+			bool expected{ false };
+			HazardRecord& record{ block->records[index] };
+			if (!record.active.load(std::memory_order_relaxed) &&
+				record.active.compare_exchange_strong(expected, true, std::memory_order_acquire, std::memory_order_relaxed))
+				return record;
+		}
+		RecordBlock* next{ block->next.load(std::memory_order_acquire) };
+		if (!next)															//   -  ,    
+		{
+			RecordBlock* added{ new RecordBlock() };
+			added->records[start].active.store(true, std::memory_order_relaxed);
+			if (block->next.compare_exchange_strong(next, added, std::memory_order_acq_rel, std::memory_order_acquire))
+			{
+				record_count.fetch_add(block_records, std::memory_order_relaxed);
+				return added->records[start];
+			}
+			delete added;													//     -   
+		}
+		block = next;
+	}
+}
+
+template <class T>
+typename MyConcurrentQueue<T>::QueueNode* MyConcurrentQueue<T>::protect(std::atomic<QueueNode*>& hazard, const std::atomic<QueueNode*>& source) noexcept {
+	QueueNode* node{ source.load(std::memory_order_acquire) };
+	for (;;)																//   ,     
+	{
+		hazard.store(node, std::memory_order_seq_cst);
+		QueueNode* actual{ source.load(std::memory_order_seq_cst) };
+		if (actual == node)
+			return node;
+		node = actual;
+	}
+}
+
+template <class T>
+template<class ...Types>
+void MyConcurrentQueue<T>::emplace(Types&&... Args) {
+	QueueNode* node{ new (alc.allocate()) QueueNode() };
+	new (node->value()) T(std::forward<Types>(Args)...);
+	HazardRecord* acquired;
+	try
+	{
+		acquired = &acquire_record();
+	}
+	catch (...)																//      -     
+	{
+		node->value()->~T();
+		node->~QueueNode();
+		alc.deallocate(node);
+		throw;
+	}
+	HazardRecord& record{ *acquired };
+	for (;;)
+	{
+		QueueNode* last{ protect(record.hazards[0], tail) };
+		QueueNode* next{ last->n.load(std::memory_order_acquire) };
+		if (last != tail.load(std::memory_order_acquire))
+			continue;
+		if (next)															//tail  -   
+		{
+			tail.compare_exchange_weak(last, next, std::memory_order_release, std::memory_order_relaxed);
+			continue;
+		}
+		if (last->n.compare_exchange_weak(next, node, std::memory_order_release, std::memory_order_relaxed))
+		{
+			tail.compare_exchange_strong(last, node, std::memory_order_release, std::memory_order_relaxed);
+			break;
+		}
+	}
+	release_record(record);
+}
+
+template <class T>
+bool MyConcurrentQueue<T>::try_pop(T& val) {
+	HazardRecord& record{ acquire_record() };
+	for (;;)
+	{
+		QueueNode* first{ protect(record.hazards[0], head) };
+		QueueNode* last{ tail.load(std::memory_order_acquire) };
+		QueueNode* next{ first->n.load(std::memory_order_acquire) };
+		record.hazards[1].store(next, std::memory_order_seq_cst);
+		if (first != head.load(std::memory_order_seq_cst))					// head  , next   
+			continue;
+		if (!next)
+		{
+			release_record(record);
+			return false;
+		}
+		if (first == last)
+		{
+			tail.compare_exchange_weak(last, next, std::memory_order_release, std::memory_order_relaxed);
+			continue;
+		}
+		if (head.compare_exchange_weak(first, next, std::memory_order_acq_rel, std::memory_order_relaxed))
+		{																	//next    -     
+			val = std::move_if_noexcept(*next->value());
+			next->value()->~T();
+			retire(record, first);
+			release_record(record);
+			return true;
+		}
+	}
+}
+
+template <class T>
+void MyConcurrentQueue<T>::retire(HazardRecord& record, QueueNode* node) noexcept {
+	node->p = record.retired;
+	record.retired = node;
+	if (++record.retired_count >= retire_threshold())
+		scan(record);
+}
+
+template <class T>
+bool MyConcurrentQueue<T>::is_hazard(const QueueNode* node) const noexcept {
+	for (const RecordBlock* block = records; block; block = block->next.load(std::memory_order_acquire))
+		for (const HazardRecord& other : block->records)
+			for (auto& hazard : other.hazards)
+				if (hazard.load(std::memory_order_seq_cst) == node)
+					return true;
+	return false;
+}
+
+template <class T>
+bool MyConcurrentQueue<T>::collect_hazards(std::vector<const QueueNode*>& hazards) const noexcept {
+	hazards.clear();
+	try
+	{
+		for (const RecordBlock* block = records; block; block = block->next.load(std::memory_order_acquire))
+			for (const HazardRecord& other : block->records)
+				for (auto& hazard : other.hazards)
+				{
+					const QueueNode* node{ hazard.load(std::memory_order_seq_cst) };
+					if (node)
+						hazards.push_back(node);
+				}
+	}
+	catch (const std::bad_alloc&)
+	{
+		return false;
+	}
+	std::sort(hazards.begin(), hazards.end(), std::less<const QueueNode*>());
+	return true;
+}
+
+template <class T>
+void MyConcurrentQueue<T>::scan(HazardRecord& record) noexcept {			//       ,      
+	QueueNode* kept{ nullptr };
+	size_t kept_count{ 0 };
+	bool snapshot{ collect_hazards(record.snapshot) };
+	for (QueueNode* node = record.retired, *prev; node; node = prev)
+	{
+		prev = node->p;
+		if (snapshot ? std::binary_search(record.snapshot.cbegin(), record.snapshot.cend(), node, std::less<const QueueNode*>()) : is_hazard(node))
+		{
+			node->p = kept;
+			kept = node;
+			++kept_count;
+		}
+		else
+		{
+			node->~QueueNode();
+			alc.deallocate(node);											//        
+		}
+	}
+	record.retired = kept;
+	record.retired_count = kept_count;
+}
+#endif	//MyConcurrentQueue_H
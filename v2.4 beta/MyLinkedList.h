@@ -8,14 +8,47 @@ v2.3
 #define PRED_TO_BOOL(pred, x, y) static_cast<bool>(pred(x, y))
 #undef RING_LIST				
 #include "MyListAllocator.h"					// 
+#include "MyListRefCount.h"					//  ,  
+#include "MyListIndex.h"						//  
+#include "MyListParallel.h"					//   
+#ifdef _MSC_VER
 #include <xstddef>								//  
+#endif
 #include <utility>								// std::forward
+#include <iterator>								// std::size  std::distance   
 #include <memory>								//   
-#include <functional>							// std::function
+#include <functional>							// std::less
+#include <vector>								//     
+#include <algorithm>							// std::min
+#include <atomic>								//   
+#include <optional>								//  parallel_reduce
+#include <type_traits>
+#include <cstdint>
+#include <cstring>								// std::memcpy       
+#include <istream>								//  
+#include <ostream>
+#include <new>									// std::launder
+#ifdef _STL_VERIFY
 #define CONTAINER_VERIFY(cond, what) _STL_VERIFY(cond, what)
+#else
+#include <cassert>
+#define CONTAINER_VERIFY(cond, what) assert((cond) && what)
+#endif
+#ifndef MYLIST_PREFETCH_DISTANCE
+#define MYLIST_PREFETCH_DISTANCE 4									//      . 0 -  
+#endif
+#if defined(__GNUC__) || defined(__clang__)
+#define MYLIST_PREFETCH(ptr) __builtin_prefetch(ptr)
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#define MYLIST_PREFETCH(ptr) _mm_prefetch(reinterpret_cast<const char*>(ptr), _MM_HINT_T0)
+#else
+#define MYLIST_PREFETCH(ptr) ((void)(ptr))
+#endif
 
-template <class T>
-class MyLinkedList {
+template <class T, template<class> class ListAllocator = MyListAllocator, class RefCount = MyAtomicRefCount>
+class MyLinkedList {								//ListAllocator - MyListAllocator   MyConcurrentListAllocator,
+													//RefCount - MyAtomicRefCount  MyPlainRefCount  ,    
 public:
 	using value_type = T;
 	using size_type = size_t;
@@ -28,30 +61,53 @@ public:
 	class const_iterator;
 	using reverse_iterator = std::reverse_iterator<iterator>;
 	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+	static constexpr size_t prefetch_distance{ MYLIST_PREFETCH_DISTANCE };
 private:
 	struct BaseNode;
 	struct Node;
+	struct Sentinel;
 	class ChainBuilder;
-	template<class Predicate> class BSTSortHelper;
-	using Allocator = MyListAllocator<Node>;
-	using SharedAllocator = std::shared_ptr<Allocator>;
+	struct Pool;
+	using Allocator = ListAllocator<Node>;
+	using Index = MyListIndex<Node>;
 private:
-	SharedAllocator alc;
+	Pool* alc;								//    (   ),   -   Pool
 	Node *my_end;							//|my_end(no data)|<---|(data)|<--->...<--->|(data)|--->|my_end(no data)|
 	size_t my_size;
+	MyPageSource* my_source;				//   ,   
+	bool my_family;							//  :       ,    
+	mutable std::unique_ptr<Index> my_index;	// enable_index().  ,     const- -    ,  
 public:
-	inline MyLinkedList() : alc{ nullptr }, my_end{ nullptr }, my_size{ 0 } {}
-	explicit MyLinkedList(size_t count);
+	class Family {																//   :     ,  
+	public:
+		inline explicit Family(MyPageSource* page_source = MyPageSource::default_source()) : alc{ new Pool(page_source) } {}
+		inline Family(const Family& o) noexcept : alc{ o.alc } { alc->refs.acquire(); }
+		inline Family& operator=(const Family& o) noexcept { o.alc->refs.acquire(); release_pool(alc); alc = o.alc; return *this; }
+		inline ~Family() noexcept { release_pool(alc); }
+		inline MyListAllocatorStatistics allocator_statistics() const noexcept { return alc->statistics(); }
+	private:
+		friend class MyLinkedList<T, ListAllocator, RefCount>;
+		Pool* alc;
+	};
+public:
+	inline MyLinkedList() : MyLinkedList(MyPageSource::default_source()) {}
+	inline explicit MyLinkedList(MyPageSource* page_source) : alc{ nullptr }, my_end{ nullptr }, my_size{ 0 }, my_source{ page_source }, my_family{ false } {}
+	inline explicit MyLinkedList(const Family& family) : alc{ family.alc }, my_end{ nullptr }, my_size{ 0 }, my_source{ family.alc->page_source() }, my_family{ true } { alc->refs.acquire(); }
+	inline explicit MyLinkedList(size_t count) : MyLinkedList() { emplace_back_n(count); }
+	inline MyLinkedList(const T* data, size_t count) : MyLinkedList() { detach_helper(); insert_helper(my_end, data, data + count, count); }	//  
 	inline MyLinkedList(const std::initializer_list<T>& init) : MyLinkedList() { detach_helper();  copy_container(init); }
-	inline MyLinkedList(const MyLinkedList& o) noexcept : my_end{ o.my_end }, my_size{ o.my_size }, alc{ o.alc } {}
-	inline MyLinkedList(MyLinkedList&& o) noexcept : MyLinkedList() { move_list(std::move(o)); }
-	MyLinkedList<T>& operator=(const MyLinkedList<T>& o);
-	MyLinkedList<T>& operator=(MyLinkedList<T>&& o) noexcept;
-	inline ~MyLinkedList() noexcept { if (!is_shared()) clear(); }
+	inline MyLinkedList(const MyLinkedList& o) noexcept : alc{ o.alc }, my_end{ o.my_end }, my_size{ o.my_size }, my_source{ o.my_source }, my_family{ o.my_family } { acquire_helper(); }
+	inline MyLinkedList(MyLinkedList&& o) noexcept : MyLinkedList(o.my_source) { move_list(std::move(o)); my_index = std::move(o.my_index); }
+	MyLinkedList<T, ListAllocator, RefCount>& operator=(const MyLinkedList<T, ListAllocator, RefCount>& o);
+	MyLinkedList<T, ListAllocator, RefCount>& operator=(MyLinkedList<T, ListAllocator, RefCount>&& o) noexcept;
+	inline ~MyLinkedList() noexcept { release_helper(); leave_family(); }
 public:
-	inline bool is_shared() const noexcept { return alc.use_count() != 1; }		
-	inline bool is_shared_with(const MyLinkedList<T>& o) const noexcept { return alc == o.alc;}
-	inline size_t shared_data_use_count() const noexcept { return alc.use_count(); }
+	inline bool is_shared() const noexcept { return !my_end || !refs(my_end).unique(); }
+	inline bool is_shared_with(const MyLinkedList<T, ListAllocator, RefCount>& o) const noexcept { return my_end == o.my_end; }
+	inline bool is_family_with(const MyLinkedList<T, ListAllocator, RefCount>& o) const noexcept { return my_family && alc == o.alc; }	//splice    - O(1)
+	inline size_t shared_data_use_count() const noexcept { return my_end ? refs(my_end).use_count() : 0; }
+	inline MyListAllocatorStatistics allocator_statistics() const noexcept { return alc ? alc->statistics() : MyListAllocatorStatistics{}; }
+	inline MyPageSource* page_source() const noexcept { return my_source; }
 	inline size_t size() const noexcept { return my_size; }
 	inline bool empty() const noexcept { return my_size == 0; }
 	inline bool isEmpty() const noexcept { return my_size == 0; }
@@ -60,29 +116,73 @@ private:
 
 	void detach_copy_helper(ChainBuilder& cb, Node* begin, Node* end, std::pair<Node*, Node*>& targets);
 
+	inline void acquire_helper() noexcept { if (my_end) refs(my_end).acquire(); if (my_family) alc->refs.acquire(); }
+	inline void release_helper() noexcept { if (my_end) release_chain(*alc, my_end, my_family); my_end = nullptr; my_size = 0; if (!my_family) alc = nullptr; reset_index(); }
+	inline void leave_family() noexcept { if (my_family) release_pool(alc); alc = nullptr; my_family = false; }	//  release_helper
+	static void release_chain(Pool& owner, Node* end, bool family) noexcept;	//       ,    - 
+	static inline void release_pool(Pool* pool) noexcept { if (pool->refs.release()) delete pool; }
+
+	static inline RefCount& refs(Node* end) noexcept { return reinterpret_cast<Sentinel*>(end)->refs; }
+
 	template<class ...Types> 
 	inline Node* create_node(Node* prev, Node* next, Types&&... Args) { return new(alc->allocate()) Node(prev, next, std::forward<Types>(Args)...); }
 
 	inline Node* create_base_node()
-	{ Node* new_node{ reinterpret_cast<Node*>(new (alc->allocate()) BaseNode()) }; new_node->n = new_node; new_node->p = new_node; return new_node;}
+	{ static_assert(sizeof(Sentinel) <= sizeof(Node), "Sentinel must fit into a node block");
+	  Node* new_node{ reinterpret_cast<Node*>(new (alc->allocate()) Sentinel()) }; new_node->n = new_node; new_node->p = new_node; return new_node;}
 
 	inline void destroy_node(Node* destroyed_node) noexcept {  destroyed_node->~Node(); alc->deallocate(destroyed_node); }
 
 	template<class ...Types>
 	inline void emplace_helper(Node* prev, Node* next, Types&&... Args)
-	{ Node* new_node{ create_node(prev, next, std::forward<Types>(Args)...) }; prev->n = new_node; next->p = new_node; }
+	{ Node* new_node{ create_node(prev, next, std::forward<Types>(Args)...) }; prev->n = new_node; next->p = new_node; if (my_index) my_index->inserted(new_node, my_end); }
+
+	void displace_helper(Node* target) noexcept { if (my_index) my_index->erased(target); target->p->n = target->n; target->n->p = target->p; destroy_node(target); }
 
-	void displace_helper(Node* target) noexcept { target->p->n = target->n; target->n->p = target->p; destroy_node(target); }
+	inline void reset_index() const noexcept { if (my_index) my_index->invalidate(); }	//  
+	Node* node_at(size_t pos) const noexcept;									//pos == my_size - my_end
+	size_t position_of(const Node* node) const noexcept;
+	Node* advance_helper(Node* node, int offset) const noexcept;
+	inline bool index_ready() const noexcept { return my_end && my_index && (my_index->valid() || my_index->build(my_end)); }	//    -  
 
 	template<class Predicate> size_t remove_helper(Predicate pred);
 
+	template<class Visitor>														// [first; last)  link   ,   prefetch_distance  .
+	static Node* scan_helper(Node* first, Node* last, Visitor visit, Node* BaseNode::* link = &BaseNode::n);	//visit(node) == true - ,  node
+	template<class Visitor> bool page_scan(Visitor visit, size_t part = 0, size_t parts = 1) const;	// part-  parts        .   pages_ready()
+	inline bool pages_ready() const noexcept { return my_end && !my_family && pages_ready_helper(static_cast<const Allocator&>(*alc), my_size + 1, 0); }	//      
+	template <class A> static inline auto pages_ready_helper(const A& pool, size_t blocks, int) noexcept -> decltype(pool.dense()) { return pool.statistics().used_blocks == blocks && pool.dense(); }
+	template <class A> static inline bool pages_ready_helper(const A&, size_t, long) noexcept { return false; }	//     
+	template <class A, class Visitor> static inline auto page_scan_helper(const A& pool, Visitor& visit, size_t part, size_t parts, int) -> decltype(pool.for_each_block(visit, part, parts))
+	{ return pool.for_each_block(visit, part, parts); }
+	template <class A, class Visitor> static inline bool page_scan_helper(const A&, Visitor&, size_t, size_t, long) { return false; }
+
+	static constexpr size_t parallel_min_chunk{ 1024 };						//     
+	inline size_t parallel_chunks(size_t threads) const noexcept { return std::max<size_t>(1, std::min(MyListParallel::threads(threads), my_size / parallel_min_chunk)); }
+	template<class ChunkVisitor> void parallel_helper(size_t chunks, bool ordered, ChunkVisitor visit) const;	//visit(chunk, scan): scan(node_visitor)   .   -  ,
+																				//       
+
 	inline size_t delete_helper(Node* first, Node* last) noexcept 
 	{ size_t count{ 1 };  Node* target; while (last != first) { target = last; last = last->p; destroy_node(target); ++count;  } destroy_node(first); return count; }
 
-	void move_list(MyLinkedList<T>&&) noexcept;
+	void move_list(MyLinkedList<T, ListAllocator, RefCount>&&) noexcept;				//       
+
+	void transfer_helper(Node* before, MyLinkedList<T, ListAllocator, RefCount>& o, Node* first, Node* last, size_t count);	// [first; last)  o  before
+
+	template <class A> static inline auto adopt_helper(A& owner, A& donor, int) noexcept -> decltype(owner.adopt(donor)) { return owner.adopt(donor); }
+	template <class A> static inline bool adopt_helper(A&, A&, long) noexcept { return false; }	//     
 
 	template <class Container> 
-	void copy_container(const Container& cont);									//       
+	inline void copy_container(const Container& cont)							//       
+	{ insert_helper(my_end, cont.begin(), cont.end(), cont.size()); }
+
+	template <class InputIt>													//        before
+	Node* insert_helper(Node* before, InputIt first, InputIt last, size_t count);	//count -  ,   ,  0
+
+	template <class InputIt> static inline size_t iterator_count(InputIt first, InputIt last)	//        
+	{ if constexpr (std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>::value) return static_cast<size_t>(std::distance(first, last)); else return 0; }
+	template <class Range> static inline auto range_count(const Range& range, int) -> decltype(static_cast<size_t>(std::size(range))) { return std::size(range); }
+	template <class Range> static inline size_t range_count(const Range& range, long) { return iterator_count(std::begin(range), std::end(range)); }
 public:
 	template<class ...Types> inline void emplace_back(Types&&... Args) 
 	{ if (is_shared()) detach_helper(); emplace_helper(my_end->p, my_end, std::forward<Types>(Args)...); ++my_size;}
@@ -96,6 +196,7 @@ public:
 	inline void append(T&& val) { emplace_back(std::move(val)); }
 	inline void prepend(T&& val) { emplace_front(std::move(val)); }
 	inline void append(const T& val) { emplace_back(val); }
+	void append(MyLinkedList<T, ListAllocator, RefCount>&& o);						// o ,        
 	inline void prepend(const T& val) { emplace_front(val); }
 
 	void pop_back() noexcept;
@@ -107,9 +208,17 @@ public:
 	inline iterator insert(iterator before, T&& val) { return emplace(before, std::move(val)); }
 	inline iterator insert(iterator before, const T& val) { return emplace(before, val); }
 	template<class InputIt> iterator insert(iterator before, InputIt first, InputIt last);
+	template<class Range> iterator insert_range(iterator before, const Range& range);	//   size()        
+	template<class Range> void append_range(const Range& range);
+	template<class ...Types> void emplace_back_n(size_t count, const Types&... Args);	//count  T(Args...);   - T()
 
 	iterator erase(iterator) noexcept;
 	iterator erase(iterator first, iterator last) noexcept;
+
+	void splice(iterator before, MyLinkedList<T, ListAllocator, RefCount>& o);		//    O(1),      (Family),
+	inline void splice(iterator before, MyLinkedList<T, ListAllocator, RefCount>&& o) { splice(before, o); }	//     
+	void splice(iterator before, MyLinkedList<T, ListAllocator, RefCount>& o, iterator target);
+	void splice(iterator before, MyLinkedList<T, ListAllocator, RefCount>& o, iterator first, iterator last);	//   - O( ),   std::list
 public:		
 	inline T& front() noexcept { CONTAINER_VERIFY(!(empty()), "Empty list"); return *begin(); }	//    ,   
 	inline T& first() noexcept { return front(); }												//     	
@@ -130,33 +239,102 @@ public:
 	size_t count(const T& val) const noexcept;
 	inline bool startsWith(const T& val) const noexcept { if (!empty()) return first() == val; return false; }
 	inline bool endsWith(const T& val) const noexcept { if (!empty()) return last() == val; return false; }
-	inline bool removeOne(const T& val) noexcept { iterator target{ find(val) }; if (target != end()) { erase(target); return true; } return false;}
+	inline bool removeOne(const T& val) noexcept												//   :   ,    
+	{ const_iterator target{ find(val, cbegin()) }; if (target != cend()) { erase(iterator(target.my_node, this)); return true; } return false; }
 	inline size_t remove(const T& val) noexcept { return removeAll(val); }
 	template<class Predicate> inline size_t remove_if(Predicate pred) { return remove_helper(pred); }
 	size_t removeAll(const T& val) noexcept { return remove_helper([&val](auto&& node_val) {return node_val == val; }); }
 public:
 	inline iterator find(const T& val) { return find(val, begin()); }
-	inline iterator find(const T& val, iterator it)	{ for (; it != end() && *it != val; ++it); return it; }
+	inline iterator find(const T& val, iterator it)	{ it.my_node = scan_helper(it.my_node, my_end, [&val](Node* node) { return node->val == val; }); return it; }
+	inline const_iterator find(const T& val) const { return find(val, cbegin()); }
+	inline const_iterator find(const T& val, const_iterator it) const { it.my_node = scan_helper(it.my_node, my_end, [&val](Node* node) { return node->val == val; }); return it; }
+	inline const_iterator constFind(const T& val) const { return find(val); }
 
 	inline iterator findFromEnd(const T& val) { return findFromEnd(val, end()); }
 																			// if(!empty()) -     end   
-	inline iterator findFromEnd(const T& val, iterator it)	{ if (!empty()) do { if (*(--it) == val) return it; }while (it != begin()); return end(); }
+	inline iterator findFromEnd(const T& val, iterator it)	{ if (!empty()) it.my_node = scan_helper(it.my_node->p, my_end, [&val](Node* node) { return node->val == val; }, &BaseNode::p); return it; }
+public:																		//  :   - O(log n),   -    
+	inline void enable_index(size_t block_size = Index::default_block_size) { if (!my_index || my_index->nodes_per_block() != block_size) my_index.reset(new Index(block_size)); }
+	inline void disable_index() noexcept { my_index.reset(); }
+	inline bool has_index() const noexcept { return static_cast<bool>(my_index); }
+
+	inline T& at(size_t pos) noexcept { CONTAINER_VERIFY(pos < my_size, "List index out of range"); if (is_shared()) detach_helper(); return node_at(pos)->val; }
+	inline const T& at(size_t pos) const noexcept { CONTAINER_VERIFY(pos < my_size, "List index out of range"); return node_at(pos)->val; }
+	inline T& operator[](size_t pos) noexcept { return at(pos); }
+	inline const T& operator[](size_t pos) const noexcept { return at(pos); }
+	inline iterator iterator_at(size_t pos) noexcept { CONTAINER_VERIFY(pos <= my_size, "List index out of range"); if (is_shared()) detach_helper(); return iterator(node_at(pos), this); }
+	inline const_iterator iterator_at(size_t pos) const noexcept { CONTAINER_VERIFY(pos <= my_size, "List index out of range"); return const_iterator(node_at(pos), this); }
+	inline size_t index_of(const_iterator it) const noexcept { return position_of(it.my_node); }
+	inline size_t index_of(iterator it) const noexcept { return position_of(it.my_node); }
 public:
-	inline void clear() noexcept { if (!empty()) { delete_helper(my_end->n, my_end->p);  alc->clear();  my_end->p = my_end; my_end->n = my_end; my_size = 0; } }
-	inline void reserve(size_t size) { if (size > my_size) alc->reserve(size-my_size); }
+	void clear() noexcept;
+	inline void reserve(size_t size) { if (is_shared()) detach_helper(); if (size > my_size) alc->reserve(size-my_size); }
+	void compact();															//        .     .   !
+	inline void shrink_to_fit() { compact(); }
 
-	void swap(MyLinkedList<T>& o) noexcept;
+	void swap(MyLinkedList<T, ListAllocator, RefCount>& o) noexcept;
 
 	inline void sort() { sort(std::less<>()); }
 
 	template<class Predicate> inline void sort(Predicate comparator) 
-	{ if (is_shared()) detach_helper(); merge_sort(my_end->n, my_end, my_size, comparator); }
-
-	inline void sort(MyLinkedList<T>::iterator begin, MyLinkedList<T>::iterator end) { sort(begin, end, std::less<>()); }
-
-	template<class Predicate> void sort(MyLinkedList<T>::iterator begin, MyLinkedList<T>::iterator end, Predicate comparator);																//  : ,  
+	{ if (is_shared()) detach_helper(); reset_index(); merge_sort(my_end->n, my_end, my_size, comparator); }
+
+	inline void adaptive_sort() { adaptive_sort(std::less<>()); }
+	template<class Predicate> inline void adaptive_sort(Predicate comparator)	//  : O(n)    
+	{ if (is_shared()) detach_helper(); reset_index(); natural_merge_sort(my_end, my_end, my_size, comparator); }
+
+	inline void radix_sort() { radix_sort([](const T& val) { return val; }); }	// ,    T
+	template<class KeyExtractor> void radix_sort(KeyExtractor key);			//    key(val):  , T     .
+																			//key     ;     
+
+	template<class Predicate> void sort(size_t threads, Predicate comparator);	//  :        
+	inline void parallel_sort(size_t threads = 0) { sort(threads, std::less<>()); }	//threads == 0 -   
+public:																		// :       MyListParallel, threads == 0 -   .
+																			//       
+	template<class Function> void parallel_for_each(Function fn, size_t threads = 0);		//   
+	template<class Function> void parallel_for_each(Function fn, size_t threads = 0) const;
+	template<class Function> void parallel_transform(Function op, size_t threads = 0);		//val = op(val)
+	template<class Predicate> size_t parallel_count_if(Predicate pred, size_t threads = 0) const;
+	inline size_t parallel_count(const T& val, size_t threads = 0) const { return parallel_count_if([&val](const T& node_val) { return node_val == val; }, threads); }
+	template<class Predicate> const_iterator parallel_find_if(Predicate pred, size_t threads = 0) const;	//    .     
+	bool parallel_contains(const T& val, size_t threads = 0) const;							//      
+	template<class U, class BinaryOp, class UnaryOp>							//reduce(U, U) , transform(val)  U.   :
+	U parallel_transform_reduce(U init, BinaryOp reduce, UnaryOp transform, size_t threads = 0) const;	//  
+	template<class U, class BinaryOp> inline U parallel_reduce(U init, BinaryOp op, size_t threads = 0) const	//U   T
+	{ return parallel_transform_reduce(std::move(init), op, [](const T& val) { return U(val); }, threads); }
+	template<class Predicate> size_t parallel_remove_if(Predicate pred, size_t threads = 0);	// - ,  -  
+private:
+	struct SerialHeader {													//  : 24    
+		char magic[4];
+		std::uint32_t byte_order;											//         
+		std::uint64_t value_size;											//sizeof(T)   , 0 -   
+		std::uint64_t count;
+		inline explicit SerialHeader(size_t val_size = 0, size_t size = 0) noexcept : magic{ 'M', 'L', 'L', '1' }, byte_order{ 0x01020304 }, value_size{ val_size }, count{ size } {}
+		inline bool matches(size_t val_size) const noexcept	//count,    size_t,  
+		{ return !std::memcmp(magic, "MLL1", 4) && byte_order == 0x01020304 && value_size == val_size && count == static_cast<size_t>(count); }
+	};
+	static constexpr size_t serial_chunk{ size_t{ 1 } << 16 };				//    -
+	inline size_t serial_reserve(size_t loaded, size_t count, size_t batch)	//     : count    ,       .
+	{ size_t grow{ std::min(count - loaded, std::max(batch, loaded)) }; alc->reserve(grow); return loaded + grow; }	//,     
+	static inline auto stream_writer(std::ostream& out) noexcept { return [&out](const void* data, size_t bytes) { out.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes)); }; }
+	static inline auto stream_reader(std::istream& in) noexcept { return [&in](void* data, size_t bytes) { return static_cast<bool>(in.read(static_cast<char*>(data), static_cast<std::streamsize>(bytes))); }; }
+public:																		// :      .   ,    
+	template<class Writer> void serialize(Writer&& write) const;			//write(const void* data, size_t bytes) -   serial_chunk .     T
+	template<class Reader> bool deserialize(Reader&& read);					//read(void* data, size_t bytes) == false -  .      ,
+																			//    .     
+	template<class Writer, class Encoder> void serialize(Writer&& write, Encoder encode) const;	//  T: encode(val, write)   
+	template<class Reader, class Decoder> bool deserialize(Reader&& read, Decoder decode);	//decode(read) -> std::optional<T>, std::nullopt - 
+	inline bool save(std::ostream& out) const { serialize(stream_writer(out)); return static_cast<bool>(out); }
+	inline bool load(std::istream& in) { return deserialize(stream_reader(in)); }
+	template<class Encoder> inline bool save(std::ostream& out, Encoder encode) const { serialize(stream_writer(out), encode); return static_cast<bool>(out); }
+	template<class Decoder> inline bool load(std::istream& in, Decoder decode) { return deserialize(stream_reader(in), decode); }
+
+	inline void sort(MyLinkedList<T, ListAllocator, RefCount>::iterator begin, MyLinkedList<T, ListAllocator, RefCount>::iterator end) { sort(begin, end, std::less<>()); }
+
+	template<class Predicate> void sort(MyLinkedList<T, ListAllocator, RefCount>::iterator begin, MyLinkedList<T, ListAllocator, RefCount>::iterator end, Predicate comparator);																//  : ,  
 	
-	static void swap(MyLinkedList<T>::iterator, MyLinkedList<T>::iterator) noexcept;
+	static void swap(MyLinkedList<T, ListAllocator, RefCount>::iterator, MyLinkedList<T, ListAllocator, RefCount>::iterator) noexcept;
 public:																		//   
 																			//  , const_iterator   nullptr  my_end
 	inline iterator begin() { if (is_shared()) detach_helper(); return iterator(my_end->n, this); }
@@ -175,41 +353,49 @@ public:																		//
 	inline const_reverse_iterator crend() const noexcept { return std::make_reverse_iterator<const_iterator>(cend()); }
 	inline const_iterator constEnd() const noexcept { return end(); }
 
+	inline const MyLinkedList<T, ListAllocator, RefCount>& as_const() const noexcept { return *this; }	//    : for (const T& val : list.as_const())
+
 public:																		// 
-	inline MyLinkedList<T>& operator+=(const T& val) { emplace_back(val); return *this; }
-	inline MyLinkedList<T>& operator+=(T&& val) { emplace_back(std::move(val)); return *this; }
-	inline MyLinkedList<T>& operator<<(const T& val) { emplace_back(val); return *this; }
-	inline MyLinkedList<T>& operator<<(T&& val) { emplace_back(std::move(val)); return *this; }
-	MyLinkedList<T>& operator+=(const MyLinkedList<T>&);
-	inline MyLinkedList<T> operator+(const MyLinkedList<T>& o) { MyLinkedList<T> result{ *this }; result += o; return result; }
-	bool operator==(const MyLinkedList<T>& o) const;						// noexcept, .. operator==    T    noexcept
-	inline bool operator!=(const MyLinkedList<T>& o) const { return !(*this == o); }
+	inline MyLinkedList<T, ListAllocator, RefCount>& operator+=(const T& val) { emplace_back(val); return *this; }
+	inline MyLinkedList<T, ListAllocator, RefCount>& operator+=(T&& val) { emplace_back(std::move(val)); return *this; }
+	inline MyLinkedList<T, ListAllocator, RefCount>& operator<<(const T& val) { emplace_back(val); return *this; }
+	inline MyLinkedList<T, ListAllocator, RefCount>& operator<<(T&& val) { emplace_back(std::move(val)); return *this; }
+	inline MyLinkedList<T, ListAllocator, RefCount>& operator+=(const MyLinkedList<T, ListAllocator, RefCount>& o) { append_range(o); return *this; }
+	inline MyLinkedList<T, ListAllocator, RefCount>& operator+=(MyLinkedList<T, ListAllocator, RefCount>&& o) { append(std::move(o)); return *this; }
+	inline friend MyLinkedList<T, ListAllocator, RefCount> operator+(const MyLinkedList<T, ListAllocator, RefCount>& l, const MyLinkedList<T, ListAllocator, RefCount>& r) { MyLinkedList<T, ListAllocator, RefCount> result{ l }; result += r; return result; }
+	inline friend MyLinkedList<T, ListAllocator, RefCount> operator+(const MyLinkedList<T, ListAllocator, RefCount>& l, MyLinkedList<T, ListAllocator, RefCount>&& r)	//      
+	{ r.insert_range(r.begin(), l); return std::move(r); }
+	inline friend MyLinkedList<T, ListAllocator, RefCount> operator+(MyLinkedList<T, ListAllocator, RefCount>&& l, const MyLinkedList<T, ListAllocator, RefCount>& r) { l += r; return std::move(l); }
+	inline friend MyLinkedList<T, ListAllocator, RefCount> operator+(MyLinkedList<T, ListAllocator, RefCount>&& l, MyLinkedList<T, ListAllocator, RefCount>&& r) { l += std::move(r); return std::move(l); }
+	bool operator==(const MyLinkedList<T, ListAllocator, RefCount>& o) const;						// noexcept, .. operator==    T    noexcept
+	inline bool operator!=(const MyLinkedList<T, ListAllocator, RefCount>& o) const { return !(*this == o); }
 
 private:
-	template<class Predicate>
-	static void tree_sort(MyLinkedList<T>::iterator& begin, MyLinkedList<T>::iterator& end, Predicate pred);
-
 	template<class Predicate> static Node* merge_sort(Node* first, Node* last, size_t size, Predicate pred);
+	template<class Predicate> static void natural_merge_sort(Node* leader, Node* closer, size_t size, Predicate pred);
+	static void reverse_helper(Node* first, Node* last) noexcept;				//  [first; last] 
+	template<class Key> static auto radix_bits(Key key) noexcept;				//     ,    
+	template<class Predicate> static void bottom_up_sort(Node* leader, Node* closer, Predicate pred);	//   leader  closer      
+	template<class Predicate> static Node* merge_runs(Node* first, Node* middle, Node* last, Predicate pred);	//    [first; middle)  [middle; last)
 	static Node* merge_helper(Node* first, Node* last);
 
 	template <class ContainerIterator>										//    [begin; end-1]    ChainBuilder
-	inline size_t copy_helper(ChainBuilder& cb, const ContainerIterator& begin, const ContainerIterator& end) 
-	{ size_t count{ 0 };  for (auto it = begin; it != end; ++it, ++count) cb.attach(create_node(nullptr, nullptr, *it)); return count; }
+	size_t copy_helper(ChainBuilder& cb, const ContainerIterator& begin, const ContainerIterator& end);	//    
 public:																		//
 	class iterator {
 	public:
 		using iterator_category = std::bidirectional_iterator_tag;
-		using value_type = MyLinkedList<T>::value_type;
+		using value_type = MyLinkedList<T, ListAllocator, RefCount>::value_type;
 		using difference_type = ptrdiff_t;
-		using pointer = MyLinkedList<T>::pointer;
-		using reference = MyLinkedList<T>::reference;
+		using pointer = MyLinkedList<T, ListAllocator, RefCount>::pointer;
+		using reference = MyLinkedList<T, ListAllocator, RefCount>::reference;
 	private:
-		friend class MyLinkedList<T>;
+		friend class MyLinkedList<T, ListAllocator, RefCount>;
 		Node* my_node;
-		MyLinkedList<T>* my_cont;
+		MyLinkedList<T, ListAllocator, RefCount>* my_cont;
 	public:
 		inline iterator() noexcept : my_node{ nullptr }, my_cont{ nullptr } {}
-		inline iterator(Node* node, MyLinkedList<T>* cont) noexcept : my_node{ node }, my_cont{ cont } {}
+		inline iterator(Node* node, MyLinkedList<T, ListAllocator, RefCount>* cont) noexcept : my_node{ node }, my_cont{ cont } {}
 		inline iterator(const iterator& o) noexcept = default;
 		inline iterator& operator=(const iterator&) noexcept = default;
 		inline ~iterator() noexcept = default;
@@ -218,8 +404,9 @@ public:																		//
 		iterator& operator--() noexcept;
 		iterator operator++(int) noexcept;
 		iterator operator--(int) noexcept;
-		inline iterator& operator+=(int offset) noexcept 
-		{ if (offset > 0) while (offset > 0) { ++(*this); --offset; } else while (offset < 0) { --(*this); ++offset; } return *this; }
+		inline iterator& operator+=(int offset) noexcept 							//    - O(log n)
+		{ if (my_cont && my_cont->my_index) { my_node = my_cont->advance_helper(my_node, offset); return *this; }
+		  if (offset > 0) while (offset > 0) { ++(*this); --offset; } else while (offset < 0) { --(*this); ++offset; } return *this; }
 		inline iterator& operator-=(int offset) noexcept { return *this += (-offset); }
 		inline iterator operator+(int offset) noexcept { iterator it{ *this };  return it += offset; }
 		inline iterator operator-(int offset) noexcept { iterator it{ *this }; return it += (-offset); }
@@ -234,18 +421,18 @@ public:																		//
 	class const_iterator {
 	public:
 		using iterator_category = std::bidirectional_iterator_tag;
-		using value_type = MyLinkedList<T>::value_type;
+		using value_type = MyLinkedList<T, ListAllocator, RefCount>::value_type;
 		using difference_type = ptrdiff_t;
-		using pointer = MyLinkedList<T>::pointer;
-		using reference = MyLinkedList<T>::reference;
+		using pointer = MyLinkedList<T, ListAllocator, RefCount>::pointer;
+		using reference = MyLinkedList<T, ListAllocator, RefCount>::reference;
 	private:
 		friend class iterator;
-		friend class MyLinkedList<T>;
+		friend class MyLinkedList<T, ListAllocator, RefCount>;
 		Node* my_node;
-		const MyLinkedList<T>* const my_cont;
+		const MyLinkedList<T, ListAllocator, RefCount>* my_cont;
 	public:
 		inline const_iterator() noexcept  : my_node{ nullptr }, my_cont{ nullptr } {}
-		inline const_iterator(Node* node, const MyLinkedList<T>* const cont) noexcept : my_node{ node }, my_cont{ cont } {}
+		inline const_iterator(Node* node, const MyLinkedList<T, ListAllocator, RefCount>* const cont) noexcept : my_node{ node }, my_cont{ cont } {}
 		inline const_iterator(const const_iterator& o) noexcept = default;
 		inline const_iterator& operator=(const const_iterator&) noexcept = default;
 		inline ~const_iterator() noexcept = default;
@@ -255,10 +442,11 @@ public:																		//
 		const_iterator operator++(int);
 		const_iterator operator--(int);
 		inline const_iterator& operator+=(int offset) noexcept 
-		{if (offset > 0)while (offset > 0){ ++(*this); --offset; }else while (offset < 0) { --(*this); ++offset; }return *this;}
+		{ if (my_cont && my_cont->my_index) { my_node = my_cont->advance_helper(my_node, offset); return *this; }
+		  if (offset > 0)while (offset > 0){ ++(*this); --offset; }else while (offset < 0) { --(*this); ++offset; }return *this;}
 		inline const_iterator& operator-=(int offset) noexcept { return *this += (-offset); }
-		inline const_iterator operator+(int offset) noexcept { iterator it{ *this };  return it += offset; }
-		inline const_iterator operator-(int offset) noexcept { iterator it{ *this }; return it += (-offset); }
+		inline const_iterator operator+(int offset) noexcept { const_iterator it{ *this };  return it += offset; }
+		inline const_iterator operator-(int offset) noexcept { const_iterator it{ *this }; return it += (-offset); }
 		inline friend const_iterator operator+(int offset, const_iterator it) noexcept { return it + offset; }
 		inline bool operator==(const const_iterator& o) const noexcept { return (my_node == o.my_node); }
 		inline bool operator!=(const const_iterator& o) const noexcept { return !(*this == o); }
@@ -275,6 +463,9 @@ private:
 		inline BaseNode& operator=(const Node&) = delete;
 		inline ~BaseNode() = default;
 	};
+	struct Sentinel : public BaseNode {										// .    Node,     
+		RefCount refs;														// ,  
+	};
 	struct Node : public BaseNode { 
 		T val;		
 		template<class ...Types>											//    value category				
@@ -283,6 +474,10 @@ private:
 		inline Node& operator=(const Node&) = delete;
 		inline ~Node() = default;
 	};
+	struct Pool : public Allocator {										//    -       .
+		using Allocator::Allocator;											//  Family   ;      
+		RefCount refs;
+	};
 
 	class ChainBuilder {													//      
 	public:
@@ -301,45 +496,43 @@ private:
 		void attach(Node* new_link) noexcept;									//    
 		void close(Node* leader, Node* closer) noexcept;						//      
 	};
-
-	template<class Predicate>
-	class BSTSortHelper {														//   
-	private:
-		Node* root;
-		int bst_size;
-		Predicate insert_cond;													// 				
-	public:	
-		inline BSTSortHelper(Predicate comparator) noexcept : root{ nullptr }, bst_size{ 0 }, insert_cond{ comparator } {}
-		inline ~BSTSortHelper() noexcept = default;
-		inline int size() const noexcept { return size; }	
-		void insert(Node*) noexcept;											//   .     -!		
-		void traverse(ChainBuilder& cb) noexcept;								// (in-order)       
-	};
 };
 
-template <class T>
-MyLinkedList<T>::MyLinkedList(size_t count)
-	: MyLinkedList() {
-	detach_helper();
-	ChainBuilder cb;
-	for (size_t i = 0; i < count; ++i)
-		cb.attach(create_node(nullptr, nullptr));
-	cb.close(my_end, my_end);
-	my_size = count;
-}
-
-template <class T>
-void MyLinkedList<T>::detach_helper(Node** first_target, Node** second_target) {
-	alc = std::make_shared<Allocator>();
-	alc->reserve(my_size + 1);
-	Node* new_end{ create_base_node() };
+template <class T, template<class> class ListAllocator, class RefCount>
+void MyLinkedList<T, ListAllocator, RefCount>::detach_helper(Node** first_target, Node** second_target) {
+	MYLIST_STAT(if (my_end) MyListStatistics::detached(my_size);)			//     -  
+	Pool* old_alc{ alc };													//   ,      
+	std::unique_ptr<Pool> new_alc;											//     ,    
+	if (!my_family)
+	{
+		new_alc.reset(new Pool(my_source));
+		alc = new_alc.get();
+	}
+	Node* new_end{ nullptr };
 	std::pair<Node*, Node*> targets{ first_target ? *first_target : nullptr, second_target ? *second_target : nullptr };
-	if (my_size)
+	ChainBuilder cb;
+	try
 	{
-		ChainBuilder cb;
-		detach_copy_helper(cb, my_end->n, my_end, targets);
-		cb.close(new_end, new_end);
+		if (new_alc && my_size)												//    
+			alc->reserve(my_size + 1);
+		new_end = create_base_node();
+		if (my_size)
+			detach_copy_helper(cb, my_end->n, my_end, targets);
+	}
+	catch (...)																//     
+	{
+		if (cb.head())
+			delete_helper(cb.head(), cb.tail());
+		if (new_end)
+			alc->deallocate(new_end);
+		alc = old_alc;
+		throw;
 	}
+	if (my_size)
+		cb.close(new_end, new_end);
+	new_alc.release();
+	if (my_end)
+		release_chain(*old_alc, my_end, my_family);
 	if (first_target)
 		if (*first_target == my_end)
 			*first_target = new_end;
@@ -351,10 +544,37 @@ void MyLinkedList<T>::detach_helper(Node** first_target, Node** second_target) {
 		else
 			*second_target  = targets.second;
 	my_end = new_end;
+	reset_index();															//     
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+void MyLinkedList<T, ListAllocator, RefCount>::release_chain(Pool& owner, Node* end, bool family) noexcept {
+	if (!refs(end).release())
+		return;
+	if (family)																//     
+	{
+		for (Node* cur = end->n, *next; cur != end; cur = next)
+		{
+			next = cur->n;
+			cur->~Node();
+			owner.deallocate(cur);
+		}
+		owner.deallocate(end);
+	}
+	else																	//   ,     
+	{
+		if (!std::is_trivially_destructible<T>::value)
+			for (Node* cur = end->n, *next; cur != end; cur = next)
+			{
+				next = cur->n;
+				cur->~Node();
+			}
+		delete &owner;
+	}
 }
 
-template <class T>
-void MyLinkedList<T>::detach_copy_helper(ChainBuilder& cb, Node* begin, Node* end, std::pair<Node*, Node*>& targets)
+template <class T, template<class> class ListAllocator, class RefCount>
+void MyLinkedList<T, ListAllocator, RefCount>::detach_copy_helper(ChainBuilder& cb, Node* begin, Node* end, std::pair<Node*, Node*>& targets)
 {
 	for (Node* cur = begin; cur != end; cur = cur->n)
 	{
@@ -366,58 +586,80 @@ void MyLinkedList<T>::detach_copy_helper(ChainBuilder& cb, Node* begin, Node* en
 	}
 }
 
-template <class T>
-template <class Container>
-void MyLinkedList<T>::copy_container(const Container& cont) {
+template <class T, template<class> class ListAllocator, class RefCount>
+template <class ContainerIterator>
+size_t MyLinkedList<T, ListAllocator, RefCount>::copy_helper(ChainBuilder& cb, const ContainerIterator& begin, const ContainerIterator& end) {
+	size_t count{ 0 };
+	try
+	{
+		for (auto it = begin; it != end; ++it, ++count)
+			cb.attach(create_node(nullptr, nullptr, *it));
+	}
+	catch (...)
+	{
+		if (cb.head())
+			delete_helper(cb.head(), cb.tail());
+		cb.reset();
+		throw;
+	}
+	return count;
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+template <class InputIt>
+typename MyLinkedList<T, ListAllocator, RefCount>::Node* MyLinkedList<T, ListAllocator, RefCount>::insert_helper(Node* before, InputIt first, InputIt last, size_t count) {
+	if (count)																//    -    
+		alc->reserve(count);
 	ChainBuilder cb;
-	alc->reserve(cont.size());
-	copy_helper(cb, cont.begin(), cont.end());
-	cb.close(my_end->n, my_end);
-	my_size = cont.size();
+	size_t inserted{ copy_helper(cb, first, last) };
+	if (!inserted)
+		return before;
+	cb.close(before->p, before);
+	my_size += inserted;
+	reset_index();
+	return cb.head();
 }
 
-template <class T>
-void MyLinkedList<T>::move_list(MyLinkedList<T>&& o) noexcept {						//      
-	if (!o.empty())
-	{
-		std::swap(my_end, o.my_end);										
-		my_size = o.my_size;
-		o.my_size = 0;														//  
-		std::swap(alc, o.alc);												//     
-	}
+template <class T, template<class> class ListAllocator, class RefCount>
+void MyLinkedList<T, ListAllocator, RefCount>::move_list(MyLinkedList<T, ListAllocator, RefCount>&& o) noexcept {						//      
+	std::swap(my_end, o.my_end);
+	std::swap(my_size, o.my_size);											//  
+	alc = o.alc;
+	my_family = o.my_family;
+	if (my_family)
+		alc->refs.acquire();												//    
+	else
+		o.alc = nullptr;													//    ,  
 }
 
-template <class T>
-MyLinkedList<T>& MyLinkedList<T>::operator=(const MyLinkedList<T>& o) {
-	if (alc != o.alc)
+template <class T, template<class> class ListAllocator, class RefCount>
+MyLinkedList<T, ListAllocator, RefCount>& MyLinkedList<T, ListAllocator, RefCount>::operator=(const MyLinkedList<T, ListAllocator, RefCount>& o) {
+	if (my_end != o.my_end)
 	{
-		if (!is_shared())
-			clear();
+		release_helper();
+		leave_family();
 		alc = o.alc;
 		my_end = o.my_end;
 		my_size = o.my_size;
+		my_family = o.my_family;
+		acquire_helper();
 	}
 	return *this;
 }
 
-template <class T>
-MyLinkedList<T>& MyLinkedList<T>::operator=(MyLinkedList<T>&& o) noexcept {
-	if (alc != o.alc) 
+template <class T, template<class> class ListAllocator, class RefCount>
+MyLinkedList<T, ListAllocator, RefCount>& MyLinkedList<T, ListAllocator, RefCount>::operator=(MyLinkedList<T, ListAllocator, RefCount>&& o) noexcept {
+	if (this != &o) 
 	{	
-		if (!is_shared())
-			clear();
-		else
-		{
-			my_end = nullptr;
-			my_size = 0;
-		}
+		release_helper();
+		leave_family();
 		move_list(std::move(o)); 
 	} 
 	return *this;
 }
 
-template <class T>
-void MyLinkedList<T>::pop_back() noexcept{
+template <class T, template<class> class ListAllocator, class RefCount>
+void MyLinkedList<T, ListAllocator, RefCount>::pop_back() noexcept{
 	CONTAINER_VERIFY(!(empty()), "Empty list");						//  ,    
 	if (is_shared())
 		detach_helper();
@@ -425,8 +667,8 @@ void MyLinkedList<T>::pop_back() noexcept{
 	--my_size;
 }
 
-template <class T>
-void MyLinkedList<T>::pop_front() noexcept{
+template <class T, template<class> class ListAllocator, class RefCount>
+void MyLinkedList<T, ListAllocator, RefCount>::pop_front() noexcept{
 	CONTAINER_VERIFY(!(empty()), "Empty list");
 	if (is_shared())
 		detach_helper();
@@ -434,9 +676,9 @@ void MyLinkedList<T>::pop_front() noexcept{
 	--my_size;
 }
 
-template <class T>
+template <class T, template<class> class ListAllocator, class RefCount>
 template<class ...Types>
-typename MyLinkedList<T>::iterator MyLinkedList<T>::emplace(iterator before, Types&&... Args) {
+typename MyLinkedList<T, ListAllocator, RefCount>::iterator MyLinkedList<T, ListAllocator, RefCount>::emplace(iterator before, Types&&... Args) {
 	CONTAINER_VERIFY(before.my_cont == this, "Can't insert into another container");
 	if (is_shared())
 		detach_helper(std::addressof(before.my_node));
@@ -445,21 +687,65 @@ typename MyLinkedList<T>::iterator MyLinkedList<T>::emplace(iterator before, Typ
 	return --before;
 }
 
-template <class T>
+template <class T, template<class> class ListAllocator, class RefCount>
 template<class InputIt> 
-typename MyLinkedList<T>::iterator MyLinkedList<T>::insert(iterator before, InputIt first, InputIt last) {
+typename MyLinkedList<T, ListAllocator, RefCount>::iterator MyLinkedList<T, ListAllocator, RefCount>::insert(iterator before, InputIt first, InputIt last) {
 	CONTAINER_VERIFY(before.my_cont == this, "Can't insert into another container");
-	if (first != last) {
-		ChainBuilder cb;
-		my_size += copy_helper(cb, first, last);
-		cb.close(before.my_node->p, before.my_node);
-		return --before;
+	if (first == last)
+		return before;
+	if (is_shared())
+		detach_helper(std::addressof(before.my_node));
+	return iterator(insert_helper(before.my_node, first, last, iterator_count(first, last)), this);
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+template<class Range>
+typename MyLinkedList<T, ListAllocator, RefCount>::iterator MyLinkedList<T, ListAllocator, RefCount>::insert_range(iterator before, const Range& range) {
+	CONTAINER_VERIFY(before.my_cont == this, "Can't insert into another container");
+	if (std::begin(range) == std::end(range))
+		return before;
+	if (is_shared())														// range -  ,    
+		detach_helper(std::addressof(before.my_node));
+	return iterator(insert_helper(before.my_node, std::begin(range), std::end(range), range_count(range, 0)), this);
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+template<class Range>
+void MyLinkedList<T, ListAllocator, RefCount>::append_range(const Range& range) {
+	if (std::begin(range) == std::end(range))								//        
+		return;
+	if (is_shared())
+		detach_helper();
+	insert_helper(my_end, std::begin(range), std::end(range), range_count(range, 0));
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+template<class ...Types>
+void MyLinkedList<T, ListAllocator, RefCount>::emplace_back_n(size_t count, const Types&... Args) {
+	if (!count)
+		return;
+	if (is_shared())
+		detach_helper();
+	alc->reserve(count);
+	ChainBuilder cb;
+	try
+	{
+		for (size_t i = 0; i < count; ++i)
+			cb.attach(create_node(nullptr, nullptr, Args...));
 	}
-	return before;
+	catch (...)
+	{
+		if (cb.head())
+			delete_helper(cb.head(), cb.tail());
+		throw;
+	}
+	cb.close(my_end->p, my_end);
+	my_size += count;
+	reset_index();
 }
 
-template <class T>
-typename MyLinkedList<T>::iterator MyLinkedList<T>::erase(typename MyLinkedList<T>::iterator target) noexcept {
+template <class T, template<class> class ListAllocator, class RefCount>
+typename MyLinkedList<T, ListAllocator, RefCount>::iterator MyLinkedList<T, ListAllocator, RefCount>::erase(typename MyLinkedList<T, ListAllocator, RefCount>::iterator target) noexcept {
 	CONTAINER_VERIFY(target.my_node != target.my_cont->cend().my_node, "Can't delete end element");
 	CONTAINER_VERIFY(target.my_cont == this, "Can't erase from another container");
 	if (is_shared())
@@ -470,8 +756,8 @@ typename MyLinkedList<T>::iterator MyLinkedList<T>::erase(typename MyLinkedList<
 	return after_target;
 }
 
-template <class T>
-typename MyLinkedList<T>::iterator MyLinkedList<T>::erase(typename MyLinkedList<T>::iterator first, typename MyLinkedList<T>::iterator last) noexcept {
+template <class T, template<class> class ListAllocator, class RefCount>
+typename MyLinkedList<T, ListAllocator, RefCount>::iterator MyLinkedList<T, ListAllocator, RefCount>::erase(typename MyLinkedList<T, ListAllocator, RefCount>::iterator first, typename MyLinkedList<T, ListAllocator, RefCount>::iterator last) noexcept {
 	CONTAINER_VERIFY(first.my_node != first.my_cont->cend().my_node, "Can't delete end element");
 	CONTAINER_VERIFY(first.my_cont == last.my_cont, "Can't erase by iterators from different containers");
 	CONTAINER_VERIFY(first.my_cont == this, "Can't erase from another container");
@@ -483,86 +769,355 @@ typename MyLinkedList<T>::iterator MyLinkedList<T>::erase(typename MyLinkedList<
 		my_size -= delete_helper(first.my_node, last.my_node->p);
 		first_prev->n = last.my_node;
 		last.my_node->p = first_prev;
+		reset_index();
 	}
 	return last;
 }
 
-template <class T>
-bool MyLinkedList<T>::contains(const T& val) const noexcept {					
-	for (const_iterator it = cbegin(); it != cend(); ++it)
-		if (*it == val)
-			return true;
-	return false;
+template <class T, template<class> class ListAllocator, class RefCount>
+bool MyLinkedList<T, ListAllocator, RefCount>::contains(const T& val) const noexcept {
+	if (!my_size)
+		return false;
+	if (pages_ready())														//    -   
+		return page_scan([&val](Node* node) { return node->val == val; });
+	return scan_helper(my_end->n, my_end, [&val](Node* node) { return node->val == val; }) != my_end;
 }
 
-template <class T>
-size_t MyLinkedList<T>::count(const T& val) const noexcept {
+template <class T, template<class> class ListAllocator, class RefCount>
+size_t MyLinkedList<T, ListAllocator, RefCount>::count(const T& val) const noexcept {
 	size_t count{ 0 };
-	for (const_iterator it = cbegin(); it != cend(); ++it)
-		if (*it == val)
-			++count;
+	if (!my_size)
+		return count;
+	auto match{ [&val, &count](Node* node) { if (node->val == val) ++count; return false; } };
+	if (pages_ready())
+		page_scan(match);
+	else
+		scan_helper(my_end->n, my_end, match);
 	return count;
 }
 
-template <class T>
+template <class T, template<class> class ListAllocator, class RefCount>
+template<class Visitor>
+bool MyLinkedList<T, ListAllocator, RefCount>::page_scan(Visitor visit, size_t part, size_t parts) const {
+	auto skip_end{ [this, &visit](Node* node) { return node != my_end && visit(node); } };	//  -  
+	return page_scan_helper(static_cast<const Allocator&>(*alc), skip_end, part, parts, 0);
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+template<class Visitor>
+typename MyLinkedList<T, ListAllocator, RefCount>::Node* MyLinkedList<T, ListAllocator, RefCount>::scan_helper(Node* first, Node* last, Visitor visit, Node* BaseNode::* link) {
+	Node* ahead{ first };													// first  prefetch_distance :     ,  
+	for (size_t i = 0; i < prefetch_distance && ahead != last; ++i)
+		ahead = ahead->*link;
+	for (; first != last; first = first->*link)
+	{
+		if (prefetch_distance && ahead != last)
+		{
+			ahead = ahead->*link;
+			MYLIST_PREFETCH(ahead);
+		}
+		if (visit(first))
+			return first;
+	}
+	return last;
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
 template<class Predicate>
-size_t MyLinkedList<T>::remove_helper(Predicate pred) {
-	if (is_shared())
-		detach_helper();
-	Node* target{ my_end->n };
+size_t MyLinkedList<T, ListAllocator, RefCount>::remove_helper(Predicate pred) {
+	Node* target{ my_end ? my_end->n : my_end };
+	bool matched{ false };
+	if (is_shared())														//  ,      
+	{
+		target = scan_helper(target, my_end, [&pred](Node* node) { return static_cast<bool>(pred(node->val)); });
+		if (target == my_end)
+			return 0;
+		detach_helper(std::addressof(target));
+		matched = true;														//      
+	}
 	size_t count{ 0 };
 	ChainBuilder cb;
-	while (target != my_end)
-	{
-		if (pred(target->val))
+	scan_helper(target, my_end, [&pred, &matched, &count, &cb](Node* node) {	//attach   node->p:   node->n  
+		if (matched || pred(node->val))
 		{
-			target->p->n = target->n;
-			target->n->p = target->p;
-			cb.attach(target);
+			node->p->n = node->n;
+			node->n->p = node->p;
+			cb.attach(node);
 			++count;
 		}
-		target = target->n;
+		matched = false;
+		return false;
+	});
+	if (count)																//   : delete_helper   
+	{
+		delete_helper(cb.head(), cb.tail());
+		reset_index();
 	}
-	delete_helper(cb.head(), cb.tail());									//     ,  delete  nullptr   
 	my_size -= count;														//   
 	return count;
 }
-template <class T>
-void MyLinkedList<T>::swap(MyLinkedList<T>& o) noexcept{
-	if (alc != o.alc)
+template <class T, template<class> class ListAllocator, class RefCount>
+void MyLinkedList<T, ListAllocator, RefCount>::compact() {
+	if (!my_end || my_family)												//      -  
+		return;
+	if (is_shared())														//      
+	{
+		detach_helper();
+		return;
+	}
+	Pool* old_alc{ alc };
+	Node* old_end{ my_end };
+	std::unique_ptr<Pool> new_alc{ new Pool(my_source) };
+	alc = new_alc.get();
+	Node* new_end{ nullptr };
+	ChainBuilder cb;
+	try
+	{
+		alc->reserve(my_size + 1);
+		new_end = create_base_node();
+		for (Node* cur = old_end->n; cur != old_end; cur = cur->n)			//         
+			cb.attach(create_node(nullptr, nullptr, std::move_if_noexcept(cur->val)));
+	}
+	catch (...)																// ,      ,   -
+	{																		//  ,     
+		if (cb.head())
+			delete_helper(cb.head(), cb.tail());
+		alc = old_alc;
+		throw;
+	}
+	if (my_size)
+		cb.close(new_end, new_end);
+	new_alc.release();
+	my_end = new_end;
+	reset_index();
+	release_chain(*old_alc, old_end, false);								//     ,    
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+void MyLinkedList<T, ListAllocator, RefCount>::swap(MyLinkedList<T, ListAllocator, RefCount>& o) noexcept{
+	if (this != &o)
 	{
 		std::swap(my_end, o.my_end);										//     										
 		std::swap(my_size, o.my_size);										// 
+		std::swap(alc, o.alc);												//    
+		std::swap(my_source, o.my_source);
+		std::swap(my_family, o.my_family);
+		std::swap(my_index, o.my_index);									//       
 	}
 }
 
-template <class T>
-MyLinkedList<T>& MyLinkedList<T>::operator+=(const MyLinkedList<T>& o) {
+template <class T, template<class> class ListAllocator, class RefCount>
+void MyLinkedList<T, ListAllocator, RefCount>::clear() noexcept {
+	if (is_shared())														//    -     
+		release_helper();
+	else if (!empty())
+	{
+		delete_helper(my_end->n, my_end->p);
+		if (!my_family)														//     
+			alc->clear();
+		my_end->p = my_end;
+		my_end->n = my_end;
+		my_size = 0;
+		reset_index();
+	}
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+void MyLinkedList<T, ListAllocator, RefCount>::splice(iterator before, MyLinkedList<T, ListAllocator, RefCount>& o) {
+	CONTAINER_VERIFY(before.my_cont == this, "Can't splice into another container");
+	CONTAINER_VERIFY(&o != this, "Can't splice container into itself");
 	if (!o.empty())
 	{
 		if (is_shared())
-			detach_helper();
-		ChainBuilder cb; 
-		copy_helper(cb, o.cbegin(), o.cend());
+			detach_helper(std::addressof(before.my_node));
+		if (o.is_shared())
+			o.detach_helper();
+		transfer_helper(before.my_node, o, o.my_end->n, o.my_end, o.my_size);
+	}
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+void MyLinkedList<T, ListAllocator, RefCount>::splice(iterator before, MyLinkedList<T, ListAllocator, RefCount>& o, iterator target) {
+	CONTAINER_VERIFY(target.my_node != target.my_cont->cend().my_node, "Can't splice end element");
+	if (&o == this)
+	{
+		iterator after_target{ target };
+		++after_target;
+		if (before != target && before != after_target)					//     before
+			splice(before, o, target, after_target);
+		return;
+	}
+	CONTAINER_VERIFY(before.my_cont == this, "Can't splice into another container");
+	CONTAINER_VERIFY(target.my_cont == &o, "Can't splice by iterator from another container");
+	if (is_shared())
+		detach_helper(std::addressof(before.my_node));
+	if (o.is_shared())
+		o.detach_helper(std::addressof(target.my_node));
+	transfer_helper(before.my_node, o, target.my_node, target.my_node->n, 1);
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+void MyLinkedList<T, ListAllocator, RefCount>::splice(iterator before, MyLinkedList<T, ListAllocator, RefCount>& o, iterator first, iterator last) {
+	CONTAINER_VERIFY(before.my_cont == this, "Can't splice into another container");
+	CONTAINER_VERIFY(first.my_cont == &o && last.my_cont == &o, "Can't splice by iterators from another container");
+	if (first == last || before == first)									//before == first -    ,      
+		return;
+	if (&o == this)															//     ,    
+	{
+		if (is_shared())
+		{
+			size_t offset{ 0 };												//     -    
+			for (Node* cur = my_end->n; cur != before.my_node; cur = cur->n)
+				++offset;
+			detach_helper(std::addressof(first.my_node), std::addressof(last.my_node));
+			for (before.my_node = my_end->n; offset > 0; --offset)
+				before.my_node = before.my_node->n;
+		}
+		if (before != last)
+		{
+			ChainBuilder cb;
+			cb.setChain(first.my_node, last.my_node->p);
+			first.my_node->p->n = last.my_node;
+			last.my_node->p = first.my_node->p;
+			cb.close(before.my_node->p, before.my_node);
+			reset_index();
+		}
+		return;
+	}
+	if (is_shared())
+		detach_helper(std::addressof(before.my_node));
+	if (o.is_shared())
+		o.detach_helper(std::addressof(first.my_node), std::addressof(last.my_node));
+	size_t count{ 0 };
+	for (Node* cur = first.my_node; cur != last.my_node; cur = cur->n)
+		++count;
+	transfer_helper(before.my_node, o, first.my_node, last.my_node, count);
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+void MyLinkedList<T, ListAllocator, RefCount>::append(MyLinkedList<T, ListAllocator, RefCount>&& o) {
+	CONTAINER_VERIFY(&o != this, "Can't append container to itself");
+	if (o.empty())
+		return;
+	if (o.is_shared())														//  -   o -   
+	{
+		append_range(o);
+		o.release_helper();
+		return;
+	}
+	if (empty() && !my_family && !o.my_family)								//     o 
+	{
+		*this = std::move(o);
+		return;
+	}
+	if (is_shared())
+		detach_helper();
+	if (alc != o.alc && !o.my_family && adopt_helper(*alc, *o.alc, 0))		// o     -    
+	{
+		ChainBuilder cb;
+		cb.setChain(o.my_end->n, o.my_end->p);
 		cb.close(my_end->p, my_end);
-		my_size = my_size + o.my_size;
+		my_size += o.my_size;
+		reset_index();
+		o.reset_index();
+		reinterpret_cast<Sentinel*>(o.my_end)->~Sentinel();				// o    
+		alc->deallocate(o.my_end);
+		o.my_end = nullptr;
+		o.my_size = 0;
+		delete o.alc;														//  o   
+		o.alc = nullptr;
+		return;
 	}
-	return *this;
+	transfer_helper(my_end, o, o.my_end->n, o.my_end, o.my_size);			//  - ,   
 }
 
-template <class T>
-bool MyLinkedList<T>::operator==(const MyLinkedList<T>& o) const {
+template <class T, template<class> class ListAllocator, class RefCount>
+void MyLinkedList<T, ListAllocator, RefCount>::transfer_helper(Node* before, MyLinkedList<T, ListAllocator, RefCount>& o, Node* first, Node* last, size_t count) {
+	ChainBuilder cb;
+	if (alc == o.alc)														// :   
+	{
+		cb.setChain(first, last->p);
+		first->p->n = last;
+		last->p = first->p;
+	}
+	else																	// :  ,     
+	{
+		try
+		{
+			for (Node* cur = first; cur != last; cur = cur->n)
+				cb.attach(create_node(nullptr, nullptr, std::move_if_noexcept(cur->val)));
+		}
+		catch (...)
+		{
+			if (cb.head())
+				delete_helper(cb.head(), cb.tail());
+			throw;
+		}
+		Node* first_prev{ first->p };
+		o.delete_helper(first, last->p);
+		first_prev->n = last;
+		last->p = first_prev;
+	}
+	cb.close(before->p, before);
+	my_size += count;
+	o.my_size -= count;
+	reset_index();
+	o.reset_index();
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+bool MyLinkedList<T, ListAllocator, RefCount>::operator==(const MyLinkedList<T, ListAllocator, RefCount>& o) const {
 	if (my_size != o.my_size)
 		return false;
-	if (alc != o.alc)																//  ,   
-		for (const_iterator it = cbegin(), o_it = o.cbegin(); it != cend(); ++it, ++o_it)
-			if (*it != *o_it)
-				return false;
-	return true;
+	if (!my_size || my_end == o.my_end)												//  ,   
+		return true;
+	Node* o_node{ o.my_end->n };													//     -    
+	return scan_helper(my_end->n, my_end, [&o_node](Node* node) { if (node->val != o_node->val) return true; o_node = o_node->n; return false; }) == my_end;
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+typename MyLinkedList<T, ListAllocator, RefCount>::Node* MyLinkedList<T, ListAllocator, RefCount>::node_at(size_t pos) const noexcept {
+	if (index_ready())
+		return my_index->node_at(pos, my_end);
+	Node* cur{ my_end };
+	if (pos < my_size / 2)
+		for (cur = cur->n; pos > 0; --pos)
+			cur = cur->n;
+	else
+		for (pos = my_size - pos; pos > 0; --pos)
+			cur = cur->p;
+	return cur;
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+size_t MyLinkedList<T, ListAllocator, RefCount>::position_of(const Node* node) const noexcept {
+	if (node == my_end)
+		return my_size;
+	if (index_ready())
+		return my_index->index_of(node, my_end);
+	size_t pos{ 0 };
+	for (const Node* cur = my_end->n; cur != node; cur = cur->n)
+		++pos;
+	return pos;
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+typename MyLinkedList<T, ListAllocator, RefCount>::Node* MyLinkedList<T, ListAllocator, RefCount>::advance_helper(Node* node, int offset) const noexcept {
+	if (static_cast<size_t>(offset < 0 ? -static_cast<long long>(offset) : offset) < my_index->nodes_per_block())	//     
+	{
+		for (; offset > 0; --offset)
+			node = node->n;
+		for (; offset < 0; ++offset)
+			node = node->p;
+		return node;
+	}
+	size_t pos{ position_of(node) + offset };
+	CONTAINER_VERIFY(pos <= my_size, "List iterator out of range");
+	return node_at(pos);
 }
 
-template <class T>
-typename MyLinkedList<T>::iterator& MyLinkedList<T>::iterator::operator++() noexcept{
+template <class T, template<class> class ListAllocator, class RefCount>
+typename MyLinkedList<T, ListAllocator, RefCount>::iterator& MyLinkedList<T, ListAllocator, RefCount>::iterator::operator++() noexcept{
 #ifndef RING_LIST
 	CONTAINER_VERIFY(my_node != my_cont->cend().my_node, "Can't increment end list iterator");
 #endif
@@ -570,36 +1125,36 @@ typename MyLinkedList<T>::iterator& MyLinkedList<T>::iterator::operator++() noex
 	return *this;
 }
 
-template <class T>
-typename MyLinkedList<T>::iterator& MyLinkedList<T>::iterator::operator--() noexcept {
+template <class T, template<class> class ListAllocator, class RefCount>
+typename MyLinkedList<T, ListAllocator, RefCount>::iterator& MyLinkedList<T, ListAllocator, RefCount>::iterator::operator--() noexcept {
 #ifndef RING_LIST
 	CONTAINER_VERIFY(my_node != my_cont->cbegin().my_node, "Can't decrement begin list iterator");
 #endif
 	my_node = my_node->p;
 	return *this;
 }
-template <class T>
-typename MyLinkedList<T>::iterator MyLinkedList<T>::iterator::operator++(int) noexcept {
+template <class T, template<class> class ListAllocator, class RefCount>
+typename MyLinkedList<T, ListAllocator, RefCount>::iterator MyLinkedList<T, ListAllocator, RefCount>::iterator::operator++(int) noexcept {
 #ifndef RING_LIST
 	CONTAINER_VERIFY(my_node != my_cont->cend().my_node, "Can't increment end list iterator");
 #endif
-	MyLinkedList<T>::iterator temp{ *this };
+	MyLinkedList<T, ListAllocator, RefCount>::iterator temp{ *this };
 	my_node = my_node->n;
 	return temp;
 }
 
-template <class T>
-typename MyLinkedList<T>::iterator MyLinkedList<T>::iterator::operator--(int) noexcept {
+template <class T, template<class> class ListAllocator, class RefCount>
+typename MyLinkedList<T, ListAllocator, RefCount>::iterator MyLinkedList<T, ListAllocator, RefCount>::iterator::operator--(int) noexcept {
 #ifndef RING_LIST
 	CONTAINER_VERIFY(my_node != my_cont->cbegin().my_node, "Can't decrement begin list iterator");
 #endif
-	MyLinkedList<T>::iterator temp{ *this };
+	MyLinkedList<T, ListAllocator, RefCount>::iterator temp{ *this };
 	my_node = my_node->p;
 	return temp;
 }
 
-template <class T>
-typename MyLinkedList<T>::const_iterator& MyLinkedList<T>::const_iterator::operator++() {
+template <class T, template<class> class ListAllocator, class RefCount>
+typename MyLinkedList<T, ListAllocator, RefCount>::const_iterator& MyLinkedList<T, ListAllocator, RefCount>::const_iterator::operator++() {
 #ifndef RING_LIST
 	CONTAINER_VERIFY(my_node != my_cont->cend().my_node, "Can't increment end list iterator");
 #endif
@@ -607,37 +1162,37 @@ typename MyLinkedList<T>::const_iterator& MyLinkedList<T>::const_iterator::opera
 	return *this;
 }
 
-template <class T>
-typename MyLinkedList<T>::const_iterator& MyLinkedList<T>::const_iterator::operator--() {
+template <class T, template<class> class ListAllocator, class RefCount>
+typename MyLinkedList<T, ListAllocator, RefCount>::const_iterator& MyLinkedList<T, ListAllocator, RefCount>::const_iterator::operator--() {
 #ifndef RING_LIST
 	CONTAINER_VERIFY(my_node != my_cont->cbegin().my_node, "Can't decrement begin list iterator");
 #endif
 	my_node = my_node->p;
 	return *this;
 }
-template <class T>
-typename MyLinkedList<T>::const_iterator MyLinkedList<T>::const_iterator::operator++(int) {
+template <class T, template<class> class ListAllocator, class RefCount>
+typename MyLinkedList<T, ListAllocator, RefCount>::const_iterator MyLinkedList<T, ListAllocator, RefCount>::const_iterator::operator++(int) {
 #ifndef RING_LIST
 	CONTAINER_VERIFY(my_node != my_cont->cend().my_node, "Can't increment end list iterator");
 #endif
-	MyLinkedList<T>::iterator temp{ *this };
+	MyLinkedList<T, ListAllocator, RefCount>::iterator temp{ *this };
 	temp.my_node = my_node->n;
 	return *this;
 }
 
-template <class T>
-typename MyLinkedList<T>::const_iterator MyLinkedList<T>::const_iterator::operator--(int) {
+template <class T, template<class> class ListAllocator, class RefCount>
+typename MyLinkedList<T, ListAllocator, RefCount>::const_iterator MyLinkedList<T, ListAllocator, RefCount>::const_iterator::operator--(int) {
 #ifndef RING_LIST
 	CONTAINER_VERIFY(my_node != my_cont->cbegin().my_node->n, "Can't decrement begin list iterator");
 #endif
-	MyLinkedList<T>::iterator temp{ *this };
+	MyLinkedList<T, ListAllocator, RefCount>::iterator temp{ *this };
 	temp.my_node = my_node->p;
 	return *this;
 }
 
 
-template<class T>																		//     !
-void MyLinkedList<T>::swap(typename MyLinkedList<T>::iterator first, typename MyLinkedList<T>::iterator second) noexcept {
+template <class T, template<class> class ListAllocator, class RefCount>																		//     !
+void MyLinkedList<T, ListAllocator, RefCount>::swap(typename MyLinkedList<T, ListAllocator, RefCount>::iterator first, typename MyLinkedList<T, ListAllocator, RefCount>::iterator second) noexcept {
 	if (first != second)
 	{
 		CONTAINER_VERIFY(first.my_node != first.my_cont->cend().my_node && second.my_node != second.my_cont->cend().my_node, "Can't swap end element");
@@ -646,6 +1201,7 @@ void MyLinkedList<T>::swap(typename MyLinkedList<T>::iterator first, typename My
 		{
 			if (first.my_cont->is_shared())
 				first.my_cont->detach_helper(std::addressof(first.my_node), std::addressof(second.my_node));
+			first.my_cont->reset_index();
 			Node* left{ first.my_node }, *right{ second.my_node };
 			if (left->p == right)
 				std::swap(left, right);
@@ -680,9 +1236,9 @@ void MyLinkedList<T>::swap(typename MyLinkedList<T>::iterator first, typename My
 	}
 }
 
-template<class T>
+template <class T, template<class> class ListAllocator, class RefCount>
 template<class Predicate>												//  begin   end  
-void MyLinkedList<T>::sort(MyLinkedList<T>::iterator begin, MyLinkedList<T>::iterator end, Predicate comparator) {
+void MyLinkedList<T, ListAllocator, RefCount>::sort(MyLinkedList<T, ListAllocator, RefCount>::iterator begin, MyLinkedList<T, ListAllocator, RefCount>::iterator end, Predicate comparator) {
 	CONTAINER_VERIFY(begin.my_cont == this && end.my_cont == this, "Can't sort by iterators from another container");
 	if (begin != end)
 	{
@@ -692,26 +1248,590 @@ void MyLinkedList<T>::sort(MyLinkedList<T>::iterator begin, MyLinkedList<T>::ite
 		{																// 
 			if (is_shared())
 				detach_helper(std::addressof(begin.my_node), std::addressof(end.my_node));
-			tree_sort(begin, end, comparator);
+			reset_index();
+			bottom_up_sort(begin.my_node->p, end.my_node, comparator);
 		}			
 	}
 }
 
-template<class T>														
+template <class T, template<class> class ListAllocator, class RefCount>
+template<class Writer>
+void MyLinkedList<T, ListAllocator, RefCount>::serialize(Writer&& write) const {
+	static_assert(std::is_trivially_copyable<T>::value, "Use serialize(write, encode) for non-trivially copyable types");
+	SerialHeader header(sizeof(T), my_size);
+	write(static_cast<const void*>(&header), sizeof(header));
+	if (!my_size)
+		return;
+	constexpr size_t chunk{ serial_chunk / sizeof(T) ? serial_chunk / sizeof(T) : 1 };
+	std::unique_ptr<unsigned char[]> buffer{ new unsigned char[chunk * sizeof(T)] };	//    -    
+	size_t filled{ 0 };
+	scan_helper(my_end->n, my_end, [&write, &buffer, &filled, chunk](Node* node) {
+		std::memcpy(buffer.get() + filled * sizeof(T), std::addressof(node->val), sizeof(T));
+		if (++filled == chunk)
+		{
+			write(static_cast<const void*>(buffer.get()), filled * sizeof(T));
+			filled = 0;
+		}
+		return false; });
+	if (filled)
+		write(static_cast<const void*>(buffer.get()), filled * sizeof(T));
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+template<class Reader>
+bool MyLinkedList<T, ListAllocator, RefCount>::deserialize(Reader&& read) {
+	static_assert(std::is_trivially_copyable<T>::value, "Use deserialize(read, decode) for non-trivially copyable types");
+	clear();
+	SerialHeader header;
+	if (!read(static_cast<void*>(&header), sizeof(header)) || !header.matches(sizeof(T)))
+		return false;
+	if (!header.count)
+		return true;
+	if (is_shared())
+		detach_helper();
+	constexpr size_t chunk{ serial_chunk / sizeof(T) ? serial_chunk / sizeof(T) : 1 };
+	std::unique_ptr<std::aligned_storage_t<sizeof(T), alignof(T)>[]> buffer{ new std::aligned_storage_t<sizeof(T), alignof(T)>[chunk] };
+	ChainBuilder cb;
+	size_t loaded{ 0 }, reserved{ 0 };
+	try
+	{
+		while (loaded < header.count)
+		{
+			if (loaded == reserved)											//    O(log n)  
+				reserved = serial_reserve(loaded, static_cast<size_t>(header.count), chunk);
+			size_t portion{ std::min(chunk, static_cast<size_t>(header.count - loaded)) };
+			if (!read(static_cast<void*>(buffer.get()), portion * sizeof(T)))
+				break;
+			for (size_t i = 0; i < portion; ++i)							//  T -   memcpy,     
+				cb.attach(create_node(nullptr, nullptr, *std::launder(reinterpret_cast<const T*>(std::addressof(buffer[i])))));
+			loaded += portion;
+		}
+	}
+	catch (...)
+	{
+		if (cb.head())
+			delete_helper(cb.head(), cb.tail());
+		throw;
+	}
+	if (loaded < header.count)												// :    
+	{
+		if (cb.head())
+			delete_helper(cb.head(), cb.tail());
+		return false;
+	}
+	cb.close(my_end->p, my_end);
+	my_size = loaded;
+	reset_index();
+	return true;
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+template<class Writer, class Encoder>
+void MyLinkedList<T, ListAllocator, RefCount>::serialize(Writer&& write, Encoder encode) const {
+	SerialHeader header(0, my_size);
+	write(static_cast<const void*>(&header), sizeof(header));
+	if (my_size)
+		scan_helper(my_end->n, my_end, [&write, &encode](Node* node) { encode(static_cast<const T&>(node->val), write); return false; });
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+template<class Reader, class Decoder>
+bool MyLinkedList<T, ListAllocator, RefCount>::deserialize(Reader&& read, Decoder decode) {
+	clear();
+	SerialHeader header;
+	if (!read(static_cast<void*>(&header), sizeof(header)) || !header.matches(0))
+		return false;
+	if (!header.count)
+		return true;
+	if (is_shared())
+		detach_helper();
+	ChainBuilder cb;
+	size_t loaded{ 0 }, reserved{ 0 };
+	try
+	{
+		for (; loaded < header.count; ++loaded)
+		{
+			if (loaded == reserved)
+				reserved = serial_reserve(loaded, static_cast<size_t>(header.count), serial_chunk / sizeof(T) ? serial_chunk / sizeof(T) : 1);
+			std::optional<T> val{ decode(read) };
+			if (!val)
+				break;
+			cb.attach(create_node(nullptr, nullptr, std::move(*val)));
+		}
+	}
+	catch (...)
+	{
+		if (cb.head())
+			delete_helper(cb.head(), cb.tail());
+		throw;
+	}
+	if (loaded < header.count)
+	{
+		if (cb.head())
+			delete_helper(cb.head(), cb.tail());
+		return false;
+	}
+	cb.close(my_end->p, my_end);
+	my_size = loaded;
+	reset_index();
+	return true;
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+template<class ChunkVisitor>
+void MyLinkedList<T, ListAllocator, RefCount>::parallel_helper(size_t chunks, bool ordered, ChunkVisitor visit) const {
+	if (!my_size)
+		return;
+	if (!ordered && pages_ready())											//     
+	{
+		MyListParallel::run(chunks, [this, chunks, &visit](size_t chunk) {
+			visit(chunk, [this, chunk, chunks](auto&& node_visit) { page_scan(node_visit, chunk, chunks); }); });
+		return;
+	}
+	std::vector<Node*> bounds(chunks + 1, my_end);							// chunk - [bounds[chunk]; bounds[chunk + 1])
+	bounds[0] = my_end->n;
+	if (index_ready())														//     O(chunks * log n)
+		for (size_t i = 1; i < chunks; ++i)
+			bounds[i] = my_index->node_at(my_size * i / chunks, my_end);
+	else
+	{
+		Node* cur{ my_end->n };
+		for (size_t i = 1, pos = 0; i < chunks; ++i)
+		{
+			for (size_t next = my_size * i / chunks; pos < next; ++pos)
+				cur = cur->n;
+			bounds[i] = cur;
+		}
+	}
+	MyListParallel::run(chunks, [&bounds, &visit](size_t chunk) {
+		Node* first{ bounds[chunk] }, * last{ bounds[chunk + 1] };
+		visit(chunk, [first, last](auto&& node_visit) { scan_helper(first, last, node_visit); }); });
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+template<class Function>
+void MyLinkedList<T, ListAllocator, RefCount>::parallel_for_each(Function fn, size_t threads) {
+	if (!my_size)
+		return;
+	if (is_shared())
+		detach_helper();
+	parallel_helper(parallel_chunks(threads), false, [&fn](size_t, auto&& scan) { scan([&fn](Node* node) { fn(node->val); return false; }); });
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+template<class Function>
+void MyLinkedList<T, ListAllocator, RefCount>::parallel_for_each(Function fn, size_t threads) const {
+	parallel_helper(parallel_chunks(threads), false, [&fn](size_t, auto&& scan) { scan([&fn](Node* node) { fn(static_cast<const T&>(node->val)); return false; }); });
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+template<class Function>
+void MyLinkedList<T, ListAllocator, RefCount>::parallel_transform(Function op, size_t threads) {
+	if (!my_size)
+		return;
+	if (is_shared())
+		detach_helper();
+	parallel_helper(parallel_chunks(threads), false, [&op](size_t, auto&& scan) { scan([&op](Node* node) { node->val = op(static_cast<const T&>(node->val)); return false; }); });
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
 template<class Predicate>
-void MyLinkedList<T>::tree_sort(typename MyLinkedList<T>::iterator& begin, typename MyLinkedList<T>::iterator& end, Predicate comparator) {
-	Node* leader{ begin.my_node->p };									// [begin; end-1]  
+size_t MyLinkedList<T, ListAllocator, RefCount>::parallel_count_if(Predicate pred, size_t threads) const {
+	size_t chunks{ parallel_chunks(threads) };
+	std::vector<size_t> counts(chunks, 0);
+	parallel_helper(chunks, false, [&pred, &counts](size_t chunk, auto&& scan) {
+		size_t count{ 0 };													// :   counts   -   
+		scan([&pred, &count](Node* node) { if (pred(static_cast<const T&>(node->val))) ++count; return false; });
+		counts[chunk] = count; });
+	size_t total{ 0 };
+	for (size_t count : counts)
+		total += count;
+	return total;
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+template<class Predicate>
+typename MyLinkedList<T, ListAllocator, RefCount>::const_iterator MyLinkedList<T, ListAllocator, RefCount>::parallel_find_if(Predicate pred, size_t threads) const {
+	size_t chunks{ parallel_chunks(threads) };
+	std::atomic<size_t> found_chunk{ chunks };								//    
+	std::vector<Node*> found(chunks, my_end);
+	parallel_helper(chunks, true, [&pred, &found_chunk, &found](size_t chunk, auto&& scan) {
+		scan([chunk, &pred, &found_chunk, &found](Node* node) {
+			if (found_chunk.load(std::memory_order_relaxed) < chunk)		//     
+				return true;
+			if (!pred(static_cast<const T&>(node->val)))
+				return false;
+			found[chunk] = node;
+			size_t current{ found_chunk.load(std::memory_order_relaxed) };
+			while (chunk < current && !found_chunk.compare_exchange_weak(current, chunk, std::memory_order_relaxed));
+			return true; }); });
+	size_t chunk{ found_chunk.load(std::memory_order_relaxed) };			//   -   
+	return const_iterator(chunk < chunks ? found[chunk] : my_end, this);
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+bool MyLinkedList<T, ListAllocator, RefCount>::parallel_contains(const T& val, size_t threads) const {
+	std::atomic<bool> found{ false };
+	parallel_helper(parallel_chunks(threads), false, [&val, &found](size_t, auto&& scan) {
+		scan([&val, &found](Node* node) {
+			if (found.load(std::memory_order_relaxed))
+				return true;
+			if (!(node->val == val))
+				return false;
+			found.store(true, std::memory_order_relaxed);
+			return true; }); });
+	return found.load(std::memory_order_relaxed);
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+template<class U, class BinaryOp, class UnaryOp>
+U MyLinkedList<T, ListAllocator, RefCount>::parallel_transform_reduce(U init, BinaryOp reduce, UnaryOp transform, size_t threads) const {
+	size_t chunks{ parallel_chunks(threads) };
+	std::vector<std::optional<U>> partials(chunks);							//   -   :   reduce  
+	parallel_helper(chunks, true, [&reduce, &transform, &partials](size_t chunk, auto&& scan) {
+		std::optional<U> partial;
+		scan([&reduce, &transform, &partial](Node* node) {
+			if (partial)
+				*partial = reduce(std::move(*partial), transform(static_cast<const T&>(node->val)));
+			else
+				partial.emplace(transform(static_cast<const T&>(node->val)));
+			return false; });
+		partials[chunk] = std::move(partial); });
+	for (std::optional<U>& partial : partials)
+		if (partial)
+			init = reduce(std::move(init), std::move(*partial));
+	return init;
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+template<class Predicate>
+size_t MyLinkedList<T, ListAllocator, RefCount>::parallel_remove_if(Predicate pred, size_t threads) {
+	if (!my_size)
+		return 0;
+	size_t chunks{ parallel_chunks(threads) };
+	if (chunks < 2)															// :       
+		return remove_helper(pred);
+	std::vector<unsigned char> marks(my_size, 0);							//,   :      
+	std::vector<size_t> counts(chunks, 0);
+	parallel_helper(chunks, true, [this, chunks, &pred, &marks, &counts](size_t chunk, auto&& scan) {
+		size_t pos{ my_size * chunk / chunks }, count{ 0 };
+		scan([&pred, &marks, &pos, &count](Node* node) {
+			if (pred(static_cast<const T&>(node->val)))
+			{
+				marks[pos] = 1;
+				++count;
+			}
+			++pos;
+			return false; });
+		counts[chunk] = count; });
+	size_t count{ 0 };
+	for (size_t chunk_count : counts)
+		count += chunk_count;
+	if (!count)																//  ,     
+		return 0;
+	if (is_shared())
+		detach_helper();
 	ChainBuilder cb;
-	BSTSortHelper<Predicate> bst(comparator);
-	while (begin != end)
-		bst.insert((begin++).my_node);									//     
-	bst.traverse(cb);
-	cb.close(leader, end.my_node);										//       (begin-1; end)
+	size_t pos{ 0 };
+	scan_helper(my_end->n, my_end, [&marks, &pos, &cb](Node* node) {
+		if (marks[pos++])
+		{
+			node->p->n = node->n;
+			node->n->p = node->p;
+			cb.attach(node);
+		}
+		return false; });
+	delete_helper(cb.head(), cb.tail());
+	reset_index();
+	my_size -= count;
+	return count;
 }
-	
-template<class T>															// .       ,
+
+template <class T, template<class> class ListAllocator, class RefCount>
+template<class Predicate>
+void MyLinkedList<T, ListAllocator, RefCount>::sort(size_t threads, Predicate comparator) {
+	constexpr size_t min_chunk{ 16384 };									//     
+	size_t chunks{ std::min(MyListParallel::threads(threads), my_size / min_chunk) };
+	if (chunks < 2)
+		return sort(comparator);
+	if (is_shared())
+		detach_helper();
+	reset_index();
+	std::vector<BaseNode> sentinels(chunks);								//          
+	std::vector<size_t> sizes(chunks);
+	auto chunk_end{ [&sentinels](size_t index) { return reinterpret_cast<Node*>(std::addressof(sentinels[index])); } };
+	Node* cur{ my_end->n };
+	for (size_t i = 0; i < chunks; ++i)
+	{
+		sizes[i] = my_size / chunks + (i < my_size % chunks);
+		Node* first{ cur };
+		for (size_t k = 1; k < sizes[i]; ++k)
+			cur = cur->n;
+		Node* next{ cur->n };
+		ChainBuilder cb;
+		cb.setChain(first, cur);
+		cb.close(chunk_end(i), chunk_end(i));
+		cur = next;
+	}
+	auto concatenate{ [&chunk_end](Node* target, Node* source) {			//  source    target  O(1)
+		if (source->n == source)
+			return;
+		ChainBuilder cb;
+		cb.setChain(source->n, source->p);
+		if (target->n != target)
+			cb.close(target->p, target);
+		else
+			cb.close(target, target);
+		source->n = source;
+		source->p = source;
+	} };
+	try
+	{
+		MyListParallel::run(chunks, [&](size_t index) {
+			Predicate local_comparator{ comparator };						//     
+			merge_sort(chunk_end(index)->n, chunk_end(index), sizes[index], local_comparator);
+		});
+		for (size_t step = 1; step < chunks; step *= 2)						//   ,   
+			MyListParallel::run((chunks - step + 2 * step - 1) / (2 * step), [&](size_t pair) {
+				Predicate local_comparator{ comparator };
+				Node* left{ chunk_end(pair * 2 * step) }, * right{ chunk_end(pair * 2 * step + step) };
+				Node* middle{ right->n };
+				concatenate(left, right);
+				merge_runs(left->n, middle, left, local_comparator);
+			});
+	}
+	catch (...)
+	{
+		my_end->n = my_end;
+		my_end->p = my_end;
+		for (size_t i = 0; i < chunks; ++i)									//   ,      
+			concatenate(my_end, chunk_end(i));
+		throw;
+	}
+	my_end->n = my_end;
+	my_end->p = my_end;
+	concatenate(my_end, chunk_end(0));
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+template<class Predicate>													//   timsort:    ,   ,
+void MyLinkedList<T, ListAllocator, RefCount>::natural_merge_sort(Node* leader, Node* closer, size_t size, Predicate comparator) {	//    min_run
+	struct Run {
+		Node* first;
+		size_t length;
+	};
+	Run runs[96];															//       
+	size_t run_count{ 0 }, min_run{ size }, odd_bits{ 0 };
+	for (; min_run >= 64; min_run >>= 1)
+		odd_bits |= min_run & 1;
+	min_run += odd_bits;
+	Node* cursor{ leader->n };												//    
+	auto merge_at{ [&runs, &run_count, &cursor, &comparator](size_t index) {
+		Node* middle{ runs[index + 1].first };
+		Node* last{ index + 2 < run_count ? runs[index + 2].first : cursor };
+		if (PRED_TO_BOOL(comparator, middle->val, middle->p->val))			//     ,  
+			runs[index].first = merge_runs(runs[index].first, middle, last, comparator);
+		runs[index].length += runs[index + 1].length;
+		for (size_t i = index + 1; i + 1 < run_count; ++i)
+			runs[i] = runs[i + 1];
+		--run_count;
+	} };
+	while (cursor != closer)
+	{
+		Node* first{ cursor }, * last{ cursor };
+		size_t length{ 1 };
+		if (last->n != closer)
+		{
+			bool descending{ PRED_TO_BOOL(comparator, last->n->val, last->val) };
+			last = last->n;
+			++length;
+			for (; last->n != closer && PRED_TO_BOOL(comparator, last->n->val, last->val) == descending; ++length)
+				last = last->n;
+			if (descending)													//     -  
+			{
+				reverse_helper(first, last);
+				std::swap(first, last);
+			}
+		}
+		for (; length < min_run && last->n != closer; ++length)				//     
+		{
+			Node* inserted{ last->n }, * position{ last };
+			while (position != first->p && PRED_TO_BOOL(comparator, inserted->val, position->val))
+				position = position->p;
+			if (position == last)
+			{
+				last = inserted;
+				continue;
+			}
+			if (position == first->p)										//    
+				first = inserted;
+			last->n = inserted->n;
+			inserted->n->p = last;
+			inserted->p = position;
+			inserted->n = position->n;
+			position->n->p = inserted;
+			position->n = inserted;
+		}
+		cursor = last->n;
+		runs[run_count++] = { first, length };
+		while (run_count > 1)												// timsort:        
+		{
+			size_t index{ run_count - 2 };
+			if ((index > 0 && runs[index - 1].length <= runs[index].length + runs[index + 1].length) ||
+				(index > 1 && runs[index - 2].length <= runs[index - 1].length + runs[index].length))
+			{
+				if (runs[index - 1].length < runs[index + 1].length)
+					--index;
+			}
+			else if (runs[index].length > runs[index + 1].length)
+				break;
+			merge_at(index);
+		}
+	}
+	while (run_count > 1)
+	{
+		size_t index{ run_count - 2 };
+		if (index > 0 && runs[index - 1].length < runs[index + 1].length)
+			--index;
+		merge_at(index);
+	}
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+template<class Key>
+auto MyLinkedList<T, ListAllocator, RefCount>::radix_bits(Key key) noexcept {
+	if constexpr (std::is_enum_v<Key>)
+		return radix_bits(static_cast<std::underlying_type_t<Key>>(key));
+	else if constexpr (std::is_same_v<Key, bool>)
+		return static_cast<unsigned char>(key);
+	else if constexpr (std::is_floating_point_v<Key>)
+	{
+		static_assert(sizeof(Key) == sizeof(uint32_t) || sizeof(Key) == sizeof(uint64_t), "Unsupported floating point key");
+		using Bits = std::conditional_t<sizeof(Key) == sizeof(uint32_t), uint32_t, uint64_t>;
+		constexpr Bits sign{ Bits{ 1 } << (sizeof(Bits) * 8 - 1) };
+		Bits bits;
+		std::memcpy(&bits, &key, sizeof(Bits));
+		return static_cast<Bits>(bits & sign ? ~bits : bits | sign);			//     ,  -  
+	}
+	else
+	{
+		static_assert(std::is_integral_v<Key>, "Radix sort key must be integral, floating point or enum");
+		using Bits = std::make_unsigned_t<Key>;
+		if constexpr (std::is_signed_v<Key>)
+			return static_cast<Bits>(static_cast<Bits>(key) ^ (Bits{ 1 } << (sizeof(Bits) * 8 - 1)));
+		else
+			return static_cast<Bits>(key);
+	}
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+template<class KeyExtractor>												//LSD    (, ): key     ,    
+void MyLinkedList<T, ListAllocator, RefCount>::radix_sort(KeyExtractor key) {
+	if (my_size < 2)
+		return;
+	if (is_shared())
+		detach_helper();
+	reset_index();
+	using Bits = decltype(radix_bits(key(my_end->n->val)));
+	using Item = std::pair<Bits, Node*>;
+	constexpr size_t key_bits{ sizeof(Bits) * 8 };
+	constexpr size_t digit_bits{ 8 };										//256  -       L1
+	constexpr size_t buckets{ size_t{ 1 } << digit_bits }, mask{ buckets - 1 };
+	constexpr size_t digits{ (key_bits + digit_bits - 1) / digit_bits };
+	auto digit_of{ [](Bits bits, size_t digit) { return static_cast<size_t>(bits >> (digit * digit_bits)) & mask; } };
+	std::vector<size_t> histogram(digits * buckets);
+	std::vector<Item> items;
+	items.reserve(my_size);
+	bool ascending{ true }, descending{ true };
+	for (Node* cur = my_end->n; cur != my_end; cur = cur->n)				//    -  :  key  std::bad_alloc   
+	{
+		Bits bits{ radix_bits(key(cur->val)) };
+		if (!items.empty())
+		{
+			ascending = ascending && items.back().first <= bits;
+			descending = descending && items.back().first > bits;
+		}
+		items.emplace_back(bits, cur);
+		for (size_t digit = 0; digit < digits; ++digit)
+			++histogram[digit * buckets + digit_of(bits, digit)];
+	}
+	if (ascending)															//  -     
+		return;
+	if (descending)															//  ,   -   
+	{
+		reverse_helper(my_end->n, my_end->p);
+		return;
+	}
+	std::vector<Item> sorted(my_size);
+	for (size_t digit = 0; digit < digits; ++digit)
+	{
+		size_t* offsets{ histogram.data() + digit * buckets };
+		if (offsets[digit_of(items.front().first, digit)] == my_size)
+			continue;														//      -    
+		for (size_t bucket = 0, total = 0; bucket < buckets; ++bucket)
+		{
+			size_t count{ offsets[bucket] };
+			offsets[bucket] = total;
+			total += count;
+		}
+		for (const Item& item : items)
+			sorted[offsets[digit_of(item.first, digit)]++] = item;
+		items.swap(sorted);
+	}
+	Node* prev{ my_end };
+	for (const Item& item : items)
+	{
+		prev->n = item.second;
+		item.second->p = prev;
+		prev = item.second;
+	}
+	prev->n = my_end;
+	my_end->p = prev;
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+void MyLinkedList<T, ListAllocator, RefCount>::reverse_helper(Node* first, Node* last) noexcept {
+	Node* const leader{ first->p }, * const closer{ last->n };
+	for (Node* cur = first, *next; cur != closer; cur = next)
+	{
+		next = cur->n;
+		std::swap(cur->p, cur->n);
+	}
+	leader->n = last;
+	last->p = leader;
+	first->n = closer;
+	closer->p = first;
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>
+template<class Predicate>													//  :   1, 2, 4...    .
+void MyLinkedList<T, ListAllocator, RefCount>::bottom_up_sort(Node* leader, Node* closer, Predicate comparator) {	//O(n log n)   , 
+	for (size_t width = 1;; width <<= 1)
+	{
+		Node* first{ leader->n }, * middle;
+		size_t merged_runs{ 0 };
+		while (first != closer)
+		{
+			middle = first;
+			for (size_t count = 0; count < width && middle != closer; ++count)
+				middle = middle->n;
+			if (middle == closer)											//    
+				break;
+			Node* last{ middle };
+			for (size_t count = 0; count < width && last != closer; ++count)
+				last = last->n;
+			merge_runs(first, middle, last, comparator);
+			++merged_runs;
+			first = last;
+		}
+		if (!merged_runs || (merged_runs == 1 && first == closer))		//      
+			return;
+	}
+}
+
+template <class T, template<class> class ListAllocator, class RefCount>															// .       ,
 template<class Predicate>													//..    
-typename MyLinkedList<T>::Node* MyLinkedList<T>::merge_sort(Node* first, Node* last, size_t size, Predicate comparator) {
+typename MyLinkedList<T, ListAllocator, RefCount>::Node* MyLinkedList<T, ListAllocator, RefCount>::merge_sort(Node* first, Node* last, size_t size, Predicate comparator) {
 	if (size < 2)
 		return first;														
 	Node* middle{ first };
@@ -719,8 +1839,13 @@ typename MyLinkedList<T>::Node* MyLinkedList<T>::merge_sort(Node* first, Node* l
 		middle = middle->n;
 	first = merge_sort(first, middle, size >> 1, comparator);
 	middle = merge_sort(middle, last, size  - (size >> 1), comparator);
-	Node* new_first{ first };
+	return merge_runs(first, middle, last, comparator);
+}
 
+template <class T, template<class> class ListAllocator, class RefCount>
+template<class Predicate>													//     :     
+typename MyLinkedList<T, ListAllocator, RefCount>::Node* MyLinkedList<T, ListAllocator, RefCount>::merge_runs(Node* first, Node* middle, Node* last, Predicate comparator) {
+	Node* new_first{ first };
 	if (PRED_TO_BOOL(comparator, middle->val, first->val))
 	{
 		new_first = middle;
@@ -750,8 +1875,8 @@ typename MyLinkedList<T>::Node* MyLinkedList<T>::merge_sort(Node* first, Node* l
 		}
 	}
 }
-template<class T>											
-typename MyLinkedList<T>::Node* MyLinkedList<T>::merge_helper(Node* first, Node* second) {
+template <class T, template<class> class ListAllocator, class RefCount>											
+typename MyLinkedList<T, ListAllocator, RefCount>::Node* MyLinkedList<T, ListAllocator, RefCount>::merge_helper(Node* first, Node* second) {
 	Node* const last{ second->n }, * const second_prev = { second->p };
 	second_prev->n = last;
 	second->n = first;
@@ -766,49 +1891,8 @@ typename MyLinkedList<T>::Node* MyLinkedList<T>::merge_helper(Node* first, Node*
 	return last;
 }
 
-template<class T>
-template<class Predicate>
-void MyLinkedList<T>::BSTSortHelper<Predicate>::insert(Node* new_node) noexcept {
-	CONTAINER_VERIFY(new_node, "Can't insert empty node");
-	new_node->p = nullptr;												//   ,    -     
-	new_node->n = nullptr;												//p       , n -  
-	if (!root)
-		root = new_node;
-	else
-	{
-		Node* parent, * child{ root };
-		while (child)
-		{
-			parent = child;
-			if (PRED_TO_BOOL(insert_cond, new_node->val, child->val))
-				child = child->p;
-			else
-				child = child->n;
-		}
-		if (PRED_TO_BOOL(insert_cond, new_node->val, parent->val))
-			parent->p = new_node;
-		else 
-			parent->n = new_node;
-	}
-	++bst_size;
-}
-
-template<class T>
-template<class Predicate>
-void MyLinkedList<T>::BSTSortHelper<Predicate>::traverse(ChainBuilder& cb) noexcept {
-	std::function<void(Node*)> builder{
-		[&cb, &builder](Node* node) {
-		if (node->p)
-			builder(node->p);
-		cb.attach(node);
-		if (node->n)
-			builder(node->n);
-	} };
-	builder(root);															//       
-}
-
-template<class T>
-void MyLinkedList<T>::ChainBuilder::attach(Node* new_link) noexcept {
+template <class T, template<class> class ListAllocator, class RefCount>
+void MyLinkedList<T, ListAllocator, RefCount>::ChainBuilder::attach(Node* new_link) noexcept {
 	if (chain_tail)
 	{
 		chain_tail->n = new_link;
@@ -819,8 +1903,8 @@ void MyLinkedList<T>::ChainBuilder::attach(Node* new_link) noexcept {
 	chain_tail = new_link;
 }
 
-template<class T>
-void MyLinkedList<T>::ChainBuilder::close(Node* leader, Node* closer) noexcept {
+template <class T, template<class> class ListAllocator, class RefCount>
+void MyLinkedList<T, ListAllocator, RefCount>::ChainBuilder::close(Node* leader, Node* closer) noexcept {
 	CONTAINER_VERIFY(chain_head && chain_tail, "Can't close empty chain");
 	chain_tail->n = closer;
 	closer->p = chain_tail;
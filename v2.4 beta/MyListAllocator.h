@@ -4,8 +4,15 @@ Dmitry Bolshakov, 2020
 #pragma once
 #ifndef MyListAllocator_H
 #define MyListAllocator_H
+#include "MyPageSource.h"						//  
+#include "MyListStatistics.h"					//   (MYLIST_STATISTICS)
 #include <memory>
+#ifdef _STL_VERIFY
 #define ALLOCATOR_VERIFY(cond, what) _STL_VERIFY(cond, what)
+#else
+#include <cassert>
+#define ALLOCATOR_VERIFY(cond, what) assert((cond) && what)
+#endif
 
 template<class T>
 class MyListAllocator {
@@ -29,12 +36,18 @@ private:
 private:																//  ,  ,       
 	const size_t block_size{ sizeof(T) };
 	const size_t header_size{ sizeof(MemoryPage) };						//   
+	MyPageSource* source;												//  : new[], std::pmr, mmap  
+#ifdef MYLIST_STATISTICS
+	struct Counters {													//  base:       
+		size_t pages{ 0 }, bytes_reserved{ 0 }, free_blocks{ 0 }, reserve_calls{ 0 }, pages_allocated{ 0 }, pages_released{ 0 };
+	} counters;
+#endif
 	MemoryPage *base, *top, *reserved_page;								//,    
 	FreeBlock *ftop;													//     
 	size_t allocated_blocks, used_blocks;	
 	bool force_page_write;												//        
 public:
-	MyListAllocator();
+	explicit MyListAllocator(MyPageSource* page_source = MyPageSource::default_source());
 	MyListAllocator(const MyListAllocator&) = delete;
 	MyListAllocator& operator=(const MyListAllocator&) = delete;
 	MyListAllocator(MyListAllocator&& o) noexcept;
@@ -44,13 +57,18 @@ public:
 	inline T* allocate() { ++used_blocks; return reinterpret_cast<T*>(allocate_block()); }	//      
 	void deallocate(T* ptr);											// 
 	void reserve(size_t	val_count);										//     
+	bool adopt(MyListAllocator& donor) noexcept;						//   donor    . false -    
+	inline MyPageSource* page_source() const noexcept { return source; }
+	MyListAllocatorStatistics statistics() const noexcept;				// MYLIST_STATISTICS    
+	bool dense() const noexcept;										//        ,   
+	template<class Visitor> bool for_each_block(Visitor visit, size_t part = 0, size_t parts = 1) const;	// part-  parts         ,
+																		//  dense(). visit(T*) == true - 
 	void clear();														//  ,   
 private:
 	byte* allocate_block();												//     
-	inline MemoryPage* allocate_page(size_t page_size)					// 
-	{ byte* new_page{ new byte[header_size + page_size] }; return new (reinterpret_cast<MemoryPage*>(new_page)) MemoryPage(page_size, top); }
-	inline void deallocate_page(MemoryPage* page) {  delete[] (reinterpret_cast<byte*>(page)); 	}	// 
-	inline void make_free(T* ptr) { ftop = new (reinterpret_cast<FreeBlock*>(ptr)) FreeBlock(ftop); }	//    
+	MemoryPage* allocate_page(size_t page_size);						// 
+	void deallocate_page(MemoryPage* page);								// 
+	inline void make_free(T* ptr) { ftop = new (reinterpret_cast<FreeBlock*>(ptr)) FreeBlock(ftop); MYLIST_STAT(++counters.free_blocks;) }	//    
 };
 
 template<class T>
@@ -59,12 +77,87 @@ template<class T>
 const size_t MyListAllocator<T>::min_allocated_blocks{ 1 };
 
 template<class T>
-MyListAllocator<T>::MyListAllocator()
-	: base{ allocate_page(block_size) }, top{ base }, reserved_page{ nullptr }, ftop{ nullptr }, allocated_blocks{ 1 }, used_blocks{ 0 }, force_page_write{ false } {
+MyListAllocator<T>::MyListAllocator(MyPageSource* page_source)
+	: source{ page_source }, base{ allocate_page(block_size) }, top{ base }, reserved_page{ nullptr }, ftop{ nullptr }, allocated_blocks{ 1 }, used_blocks{ 0 }, force_page_write{ false } {
 	ALLOCATOR_VERIFY(sizeof(FreeBlock) <= block_size, "Size of value can't be less than pointer size (in bytes)");
 	base->prev = nullptr;												//  -    
 }
 
+template<class T>
+typename MyListAllocator<T>::MemoryPage* MyListAllocator<T>::allocate_page(size_t page_size) {
+	byte* new_page{ static_cast<byte*>(source->allocate_page(header_size + page_size)) };
+	MYLIST_STAT(
+		++counters.pages;
+		++counters.pages_allocated;
+		counters.bytes_reserved += header_size + page_size;
+		MyListStatistics::page_allocated(new_page, header_size + page_size);
+	)
+	return new (reinterpret_cast<MemoryPage*>(new_page)) MemoryPage(page_size, top);
+}
+
+template<class T>
+void MyListAllocator<T>::deallocate_page(MemoryPage* page) {
+	if (!page)
+		return;
+	MYLIST_STAT(
+		--counters.pages;
+		++counters.pages_released;
+		counters.bytes_reserved -= header_size + page->size;
+		MyListStatistics::page_released(page, header_size + page->size);
+	)
+	source->deallocate_page(page, header_size + page->size);
+}
+
+template<class T>
+MyListAllocatorStatistics MyListAllocator<T>::statistics() const noexcept {
+	MyListAllocatorStatistics stats{};
+	stats.allocated_blocks = allocated_blocks;
+	stats.used_blocks = used_blocks;
+#ifdef MYLIST_STATISTICS
+	stats.pages = counters.pages;
+	stats.bytes_reserved = counters.bytes_reserved;
+	stats.free_blocks = counters.free_blocks;
+	stats.reserve_calls = counters.reserve_calls;
+	stats.pages_allocated = counters.pages_allocated;
+	stats.pages_released = counters.pages_released;
+#endif
+	return stats;
+}
+
+template<class T>
+bool MyListAllocator<T>::dense() const noexcept {
+	if (ftop)
+		return false;
+	size_t blocks{ 0 };
+	for (MemoryPage* page = top; page; page = page->prev)				// O(log n):      
+		blocks += page->offset / block_size;
+	return blocks == used_blocks;										//    ,   adopt()
+}
+
+template<class T>
+template<class Visitor>
+bool MyListAllocator<T>::for_each_block(Visitor visit, size_t part, size_t parts) const {
+	ALLOCATOR_VERIFY(dense() && part < parts, "Allocator pages have free blocks");
+	size_t total{ 0 };
+	for (MemoryPage* page = top; page; page = page->prev)
+		total += page->offset / block_size;
+	size_t first{ total * part / parts }, last{ total * (part + 1) / parts }, index{ 0 };	//     :      
+	for (MemoryPage* page = top; page && index < last; page = page->prev)
+	{
+		size_t count{ page->offset / block_size };
+		if (index + count > first)
+		{
+			byte* block{ reinterpret_cast<byte*>(page) + header_size + (first > index ? first - index : 0) * block_size };
+			byte* end{ reinterpret_cast<byte*>(page) + header_size + (last - index < count ? last - index : count) * block_size };
+			for (; block != end; block += block_size)					//  -    
+				if (visit(reinterpret_cast<T*>(block)))
+					return true;
+		}
+		index += count;
+	}
+	return false;
+}
+
 template<class T>
 void MyListAllocator<T>::clear() {
 	MemoryPage *mpage;
@@ -74,28 +167,89 @@ void MyListAllocator<T>::clear() {
 		top = top->prev;
 		deallocate_page(mpage);
 	}
-	deallocate_page(reserved_page);										//  .   reserved_page == nullptr,  delete 
+	deallocate_page(reserved_page);										//  .   reserved_page == nullptr,  
 	reserved_page = nullptr;											//    -  !
 	ftop = nullptr;
+	MYLIST_STAT(counters.free_blocks = 0;)
 	allocated_blocks = (base) ? 1 : 0;
 	used_blocks = (base) ? 1 : 0;
 }
 
+template<class T>
+bool MyListAllocator<T>::adopt(MyListAllocator& donor) noexcept {
+	if (&donor == this || source != donor.source)						//     ,   
+		return false;
+	if (donor.top)
+	{
+		MemoryPage* donor_bottom{ donor.top };
+		while (donor_bottom->prev)
+			donor_bottom = donor_bottom->prev;
+		if (!top || top->offset == top->size)							//     -      donor
+		{
+			donor_bottom->prev = top;
+			top = donor.top;
+		}
+		else															//  donor   , base -  
+		{
+			donor_bottom->prev = top->prev;
+			top->prev = donor.top;
+		}
+	}
+	if (donor.reserved_page)
+	{
+		if (reserved_page)
+		{
+			donor.allocated_blocks -= donor.reserved_page->size / block_size;
+			donor.deallocate_page(donor.reserved_page);
+		}
+		else
+			reserved_page = donor.reserved_page;
+	}
+	if (donor.ftop)														//   
+	{
+		FreeBlock* donor_last{ donor.ftop };
+		while (donor_last->prev)
+			donor_last = donor_last->prev;
+		donor_last->prev = ftop;
+		ftop = donor.ftop;
+	}
+	allocated_blocks += donor.allocated_blocks;
+	used_blocks += donor.used_blocks;
+	MYLIST_STAT(
+		counters.pages += donor.counters.pages;							//     
+		counters.pages_allocated += donor.counters.pages;
+		counters.bytes_reserved += donor.counters.bytes_reserved;
+		counters.free_blocks += donor.counters.free_blocks;
+		donor.counters.pages = 0;
+		donor.counters.bytes_reserved = 0;
+		donor.counters.free_blocks = 0;
+	)
+	donor.base = nullptr;												//donor  ,    
+	donor.top = nullptr;
+	donor.reserved_page = nullptr;
+	donor.ftop = nullptr;
+	donor.allocated_blocks = 0;
+	donor.used_blocks = 0;
+	return true;
+}
+
 template<class T>
 MyListAllocator<T>::MyListAllocator(MyListAllocator&& o) noexcept
-	: base{ o.base }, top{ o.top }, reserved_page{ o.reserved_page }, ftop{ o.ftop }, allocated_blocks{ o.allocated_blocks }, used_blocks{ o.used_blocks }, force_page_write{ false } {
+	: source{ o.source }, base{ o.base }, top{ o.top }, reserved_page{ o.reserved_page }, ftop{ o.ftop }, allocated_blocks{ o.allocated_blocks }, used_blocks{ o.used_blocks }, force_page_write{ false } {
 	o.base = nullptr;
 	o.top = nullptr;
 	o.reserved_page = nullptr;
 	o.ftop = nullptr;
 	o.allocated_blocks = 0;
 	o.used_blocks = 0;
+	MYLIST_STAT(counters = o.counters; o.counters = Counters();)
 }
 
 template<class T>
 MyListAllocator<T>& MyListAllocator<T>::operator=(MyListAllocator&& o) noexcept {
 	if (this != &o)
 	{
+		source = o.source;
 		base = o.base;
 		o.base = nullptr;
 		top = o.top;
@@ -110,6 +264,7 @@ MyListAllocator<T>& MyListAllocator<T>::operator=(MyListAllocator&& o) noexcept
 		o.used_blocks = 0;
 		force_page_write = o.force_page_write;
 		o.force_page_write = false;
+		MYLIST_STAT(counters = o.counters; o.counters = Counters();)
 	}
 	return *this;
 }
@@ -144,10 +299,13 @@ void MyListAllocator<T>::deallocate(T* val) {
 template<class T>
 typename MyListAllocator<T>::byte* MyListAllocator<T>::allocate_block() {
 	byte* block;
+	if (force_page_write && ftop && !reserved_page && (!top || top->offset == top->size))
+		force_page_write = false;									//   -      
 	if (!force_page_write && ftop)									//  -  
 	{
 		block = reinterpret_cast<byte*>(ftop);
 		ftop = ftop->prev;
+		MYLIST_STAT(--counters.free_blocks;)
 	}
 	else
 	{
@@ -177,22 +335,24 @@ typename MyListAllocator<T>::byte* MyListAllocator<T>::allocate_block() {
 
 template<class T>
 void MyListAllocator<T>::reserve(size_t val_count) {
+	MYLIST_STAT(++counters.reserve_calls;)
 	if (val_count > 0)
 	{
-		size_t new_blocks_count{ val_count - ((top->size - top->offset) / block_size) };	// - ,   
-		if (new_blocks_count > 0)
+		size_t top_free_blocks{ top ? (top->size - top->offset) / block_size : 0 };			//    ,    
+		if (val_count > top_free_blocks)													//        
 		{		
+			size_t new_blocks_count{ val_count - top_free_blocks };							// - ,   
 			if (!reserved_page || reserved_page->size/block_size < new_blocks_count)		//       ?
 			{	
 				if (reserved_page)															//   - ,   ...
 				{
-					allocated_blocks -= reserved_page->size;								//...       
+					allocated_blocks -= reserved_page->size / block_size;					//...    (size -  )    
 					deallocate_page(reserved_page);						
 				}
 				reserved_page = allocate_page(new_blocks_count * block_size);				//   
 				allocated_blocks += new_blocks_count;										//   
 			}
-			if (top->offset == top->size)													// top ,    ...
+			if (!top || top->offset == top->size)											// top ,    ...
 			{
 				reserved_page->prev = top;
 				top = reserved_page;
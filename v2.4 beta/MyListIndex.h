@@ -0,0 +1,340 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#pragma once
+#ifndef MyListIndex_H
+#define MyListIndex_H
+#include "MyListAllocator.h"					//  -   
+#include <unordered_map>						//   -> 
+#include <utility>
+
+template <class Node>
+class MyListIndex {															//  :    ()       .
+public:																		// ->    ->   O(log(n / block_size) + block_size).
+	static constexpr size_t default_block_size{ 32 };						// -    - ( 100 )  block_size..2*block_size 
+private:
+	struct Block {
+		Node* head;															//  
+		size_t count;														//  
+		size_t total;														//   
+		unsigned priority;
+		Block* left, * right, * parent;
+	};
+private:
+	MyListAllocator<Block> alc;
+	std::unordered_map<const Node*, Block*> heads;
+	Block* root;
+	size_t block_size;
+	unsigned seed;
+	bool is_valid;
+public:
+	inline explicit MyListIndex(size_t block_nodes = default_block_size) : root{ nullptr }, block_size{ block_nodes ? block_nodes : 1 }, seed{ 2463534242u }, is_valid{ false } {}
+	MyListIndex(const MyListIndex&) = delete;
+	MyListIndex& operator=(const MyListIndex&) = delete;
+public:
+	inline bool valid() const noexcept { return is_valid; }
+	inline size_t nodes_per_block() const noexcept { return block_size; }
+	inline size_t blocks() const noexcept { return heads.size(); }
+	void invalidate() noexcept;												//  :     
+	bool build(Node* end) noexcept;											//O(n). false -   ,   
+
+	Node* node_at(size_t pos, Node* end) const noexcept;					//pos ==  - end
+	size_t index_of(const Node* node, const Node* end) const noexcept;
+
+	void inserted(Node* node, Node* end) noexcept;							//node    
+	void erased(Node* node) noexcept;										//node   
+private:
+	static inline size_t total(const Block* b) noexcept { return b ? b->total : 0; }
+	static inline void update(Block* b) noexcept { b->total = b->count + total(b->left) + total(b->right); }
+	static inline void add(Block* b, size_t delta) noexcept { for (; b; b = b->parent) b->total += delta; }	//    
+	inline unsigned next_priority() noexcept { seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5; return seed; }
+
+	Block* block_of(const Node* node, size_t& offset) const noexcept;		//     :   2*block_size 
+	Block* rightmost() const noexcept;
+	Block* successor(Block* b) const noexcept;
+	size_t rank(const Block* b) const noexcept;								//  
+	Block* create_block(Node* head, size_t count);
+	void insert_after(Block* b, Block* inserted) noexcept;					//b == nullptr -  
+	void remove(Block* b) noexcept;
+	void rotate_up(Block* b) noexcept;
+};
+
+template <class Node>
+void MyListIndex<Node>::invalidate() noexcept {
+	if (!is_valid && !root)
+		return;
+	heads.clear();
+	alc.clear();															//  -    
+	root = nullptr;
+	is_valid = false;
+}
+
+template <class Node>
+bool MyListIndex<Node>::build(Node* end) noexcept {
+	invalidate();
+	try
+	{
+		Block* last{ nullptr };
+		for (Node* cur = end->n; cur != end;)
+		{
+			Block* b{ create_block(cur, 0) };
+			for (; cur != end && b->count < block_size; cur = cur->n)
+				++b->count;
+			b->total = b->count;
+			insert_after(last, b);											// :    O(1),      
+			last = b;
+		}
+	}
+	catch (...)
+	{
+		invalidate();
+		return false;
+	}
+	is_valid = true;
+	return true;
+}
+
+template <class Node>
+typename MyListIndex<Node>::Block* MyListIndex<Node>::create_block(Node* head, size_t count) {
+	Block* b{ new (alc.allocate()) Block{ head, count, count, next_priority(), nullptr, nullptr, nullptr } };
+	try
+	{
+		heads.emplace(head, b);
+	}
+	catch (...)
+	{
+		alc.deallocate(b);
+		throw;
+	}
+	return b;
+}
+
+template <class Node>
+Node* MyListIndex<Node>::node_at(size_t pos, Node* end) const noexcept {
+	if (pos >= total(root))
+		return end;
+	Block* b{ root };
+	for (;;)
+	{
+		size_t left_total{ total(b->left) };
+		if (pos < left_total)
+			b = b->left;
+		else if (pos < left_total + b->count)
+		{
+			pos -= left_total;
+			break;
+		}
+		else
+		{
+			pos -= left_total + b->count;
+			b = b->right;
+		}
+	}
+	Node* node{ b->head };
+	for (; pos > 0; --pos)
+		node = node->n;
+	return node;
+}
+
+template <class Node>
+size_t MyListIndex<Node>::index_of(const Node* node, const Node* end) const noexcept {
+	if (node == end)
+		return total(root);
+	size_t offset;
+	Block* b{ block_of(node, offset) };
+	return rank(b) + offset;
+}
+
+template <class Node>
+typename MyListIndex<Node>::Block* MyListIndex<Node>::block_of(const Node* node, size_t& offset) const noexcept {
+	offset = 0;
+	for (;; node = node->p, ++offset)
+	{
+		auto found{ heads.find(node) };
+		if (found != heads.end())
+			return found->second;
+	}
+}
+
+template <class Node>
+size_t MyListIndex<Node>::rank(const Block* b) const noexcept {
+	size_t result{ total(b->left) };
+	for (; b->parent; b = b->parent)
+		if (b == b->parent->right)
+			result += total(b->parent->left) + b->parent->count;
+	return result;
+}
+
+template <class Node>
+typename MyListIndex<Node>::Block* MyListIndex<Node>::rightmost() const noexcept {
+	Block* b{ root };
+	while (b && b->right)
+		b = b->right;
+	return b;
+}
+
+template <class Node>
+typename MyListIndex<Node>::Block* MyListIndex<Node>::successor(Block* b) const noexcept {
+	if (b->right)
+	{
+		for (b = b->right; b->left; b = b->left);
+		return b;
+	}
+	while (b->parent && b == b->parent->right)
+		b = b->parent;
+	return b->parent;
+}
+
+template <class Node>
+void MyListIndex<Node>::inserted(Node* node, Node* end) noexcept {
+	if (!is_valid)
+		return;
+	try
+	{
+		Block* b;
+		if (!root)															//   
+		{
+			insert_after(nullptr, create_block(node, 1));
+			return;
+		}
+		if (node->n == end)													//   -   
+			b = rightmost();
+		else
+		{
+			size_t offset;
+			b = block_of(node->n, offset);
+			if (b->head == node->n)											//    
+			{
+				auto entry{ heads.extract(node->n) };						// -  -   
+				entry.key() = node;
+				heads.insert(std::move(entry));
+				b->head = node;
+			}
+		}
+		++b->count;
+		add(b, 1);
+		if (b->count >= 2 * block_size)										//   
+		{
+			Node* middle{ b->head };
+			for (size_t i = 0; i < block_size; ++i)
+				middle = middle->n;
+			Block* half{ create_block(middle, 0) };
+			half->total = half->count = b->count - block_size;
+			b->count = block_size;
+			add(b, 0 - half->count);
+			insert_after(b, half);
+		}
+	}
+	catch (...)
+	{
+		invalidate();
+	}
+}
+
+template <class Node>
+void MyListIndex<Node>::erased(Node* node) noexcept {
+	if (!is_valid)
+		return;
+	size_t offset;
+	Block* b{ block_of(node, offset) };
+	--b->count;
+	add(b, 0 - size_t{ 1 });
+	if (!b->count)
+	{
+		heads.erase(node);
+		remove(b);
+		alc.deallocate(b);
+		return;
+	}
+	if (!offset)															//    -   
+	{
+		auto entry{ heads.extract(node) };
+		entry.key() = node->n;
+		b->head = node->n;
+		heads.insert(std::move(entry));
+	}
+	Block* next{ successor(b) };
+	if (next && b->count + next->count <= block_size)						//   
+	{
+		heads.erase(next->head);
+		remove(next);
+		b->count += next->count;
+		add(b, next->count);
+		alc.deallocate(next);
+	}
+}
+
+template <class Node>
+void MyListIndex<Node>::insert_after(Block* b, Block* inserted) noexcept {
+	if (!root)
+	{
+		root = inserted;
+		return;
+	}
+	Block* parent;
+	if (!b)
+	{
+		for (parent = root; parent->left; parent = parent->left);
+		parent->left = inserted;
+	}
+	else if (!b->right)
+	{
+		parent = b;
+		parent->right = inserted;
+	}
+	else
+	{
+		for (parent = b->right; parent->left; parent = parent->left);
+		parent->left = inserted;
+	}
+	inserted->parent = parent;
+	add(parent, inserted->count);
+	while (inserted->parent && inserted->parent->priority < inserted->priority)
+		rotate_up(inserted);
+}
+
+template <class Node>
+void MyListIndex<Node>::remove(Block* b) noexcept {
+	while (b->left && b->right)												// ,     
+		rotate_up(b->left->priority > b->right->priority ? b->left : b->right);
+	Block* child{ b->left ? b->left : b->right }, * parent{ b->parent };
+	if (child)
+		child->parent = parent;
+	if (!parent)
+		root = child;
+	else if (parent->left == b)
+		parent->left = child;
+	else
+		parent->right = child;
+	add(parent, 0 - b->count);
+}
+
+template <class Node>
+void MyListIndex<Node>::rotate_up(Block* b) noexcept {
+	Block* parent{ b->parent }, * grand{ parent->parent };
+	if (b == parent->left)
+	{
+		parent->left = b->right;
+		if (b->right)
+			b->right->parent = parent;
+		b->right = parent;
+	}
+	else
+	{
+		parent->right = b->left;
+		if (b->left)
+			b->left->parent = parent;
+		b->left = parent;
+	}
+	parent->parent = b;
+	b->parent = grand;
+	if (!grand)
+		root = b;
+	else if (grand->left == parent)
+		grand->left = b;
+	else
+		grand->right = b;
+	update(parent);
+	update(b);
+}
+#endif	//MyListIndex_H
@@ -0,0 +1,137 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#pragma once
+#ifndef MyListParallel_H
+#define MyListParallel_H
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <deque>
+#include <algorithm>							// std::find
+#include <type_traits>
+#include <system_error>							//  
+#include <exception>							//    
+
+class MyListParallel {														//         
+public:
+	static inline size_t default_threads() noexcept { unsigned count{ std::thread::hardware_concurrency() }; return count ? count : 1; }
+	static inline size_t threads(size_t requested) noexcept { return requested ? requested : default_threads(); }	//0 -   .    
+																			//:    default_threads() - 1  ,
+																			//  ,  ,   
+
+	template <class Task>
+	static void run(size_t tasks, Task&& task);								//task(i)  i  [0; tasks).     ,    ,
+																			//  run     
+private:
+	struct Job {															//   run.      
+		void (*call)(void* task, size_t index);
+		void* task;
+		size_t tasks;
+		size_t next;														//  
+		size_t done;
+		std::exception_ptr* errors;
+	};
+	class Pool {
+	public:
+		Pool();
+		Pool(const Pool&) = delete;
+		Pool& operator=(const Pool&) = delete;
+		~Pool() noexcept;
+		void run(Job& job);
+	private:
+		void work() noexcept;
+		bool execute(Job& job, std::unique_lock<std::mutex>& lock) noexcept;	//   job. false -  
+	private:
+		std::mutex mutex;
+		std::condition_variable wake, finished;
+		std::deque<Job*> jobs;												// run,     
+		std::vector<std::thread> workers;
+		bool stopping;
+	};
+	static inline Pool& pool() { static Pool instance; return instance; }	//        
+};
+
+template <class Task>
+void MyListParallel::run(size_t tasks, Task&& task) {
+	if (tasks < 2)
+	{
+		if (tasks)
+			task(size_t{ 0 });
+		return;
+	}
+	std::vector<std::exception_ptr> errors(tasks);
+	using TaskType = typename std::remove_reference<Task>::type;
+	Job job{ [](void* target, size_t index) { (*static_cast<TaskType*>(target))(index); }, const_cast<void*>(static_cast<const void*>(&task)), tasks, 0, 0, errors.data() };
+	pool().run(job);
+	for (std::exception_ptr& error : errors)
+		if (error)
+			std::rethrow_exception(error);
+}
+
+inline MyListParallel::Pool::Pool() : stopping{ false } {
+	size_t count{ default_threads() - 1 };									//     
+	workers.reserve(count);
+	try
+	{
+		for (size_t i = 0; i < count; ++i)
+			workers.emplace_back([this] { work(); });
+	}
+	catch (const std::system_error&)										// ,  :    ,   - 
+	{
+	}
+}
+
+inline MyListParallel::Pool::~Pool() noexcept {
+	{
+		std::lock_guard<std::mutex> lock{ mutex };
+		stopping = true;
+	}
+	wake.notify_all();
+	for (std::thread& worker : workers)
+		worker.join();
+}
+
+inline bool MyListParallel::Pool::execute(Job& job, std::unique_lock<std::mutex>& lock) noexcept {
+	if (job.next == job.tasks)
+		return false;
+	size_t index{ job.next++ };
+	if (job.next == job.tasks)												//   -     
+		jobs.erase(std::find(jobs.begin(), jobs.end(), &job));
+	lock.unlock();
+	try
+	{
+		job.call(job.task, index);
+	}
+	catch (...)
+	{
+		job.errors[index] = std::current_exception();
+	}
+	lock.lock();
+	if (++job.done == job.tasks)
+		finished.notify_all();
+	return true;
+}
+
+inline void MyListParallel::Pool::run(Job& job) {
+	std::unique_lock<std::mutex> lock{ mutex };
+	jobs.push_back(&job);
+	if (!workers.empty())
+		wake.notify_all();
+	while (execute(job, lock))
+		;
+	finished.wait(lock, [&job] { return job.done == job.tasks; });			// ,     
+}
+
+inline void MyListParallel::Pool::work() noexcept {
+	std::unique_lock<std::mutex> lock{ mutex };
+	for (;;)
+	{
+		wake.wait(lock, [this] { return stopping || !jobs.empty(); });
+		if (stopping)
+			return;
+		execute(*jobs.front(), lock);
+	}
+}
+#endif	//MyListParallel_H
@@ -0,0 +1,37 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#pragma once
+#ifndef MyListRefCount_H
+#define MyListRefCount_H
+#include <cstddef>
+#include <atomic>
+
+class MyAtomicRefCount {													//    :      
+private:
+	std::atomic<size_t> refs;
+public:
+	inline MyAtomicRefCount() noexcept : refs{ 1 } {}
+	MyAtomicRefCount(const MyAtomicRefCount&) = delete;
+	MyAtomicRefCount& operator=(const MyAtomicRefCount&) = delete;
+public:
+	inline void acquire() noexcept { refs.fetch_add(1, std::memory_order_relaxed); }
+	inline bool release() noexcept { return refs.fetch_sub(1, std::memory_order_acq_rel) == 1; }	//true -   
+	inline bool unique() const noexcept { return refs.load(std::memory_order_acquire) == 1; }	//acquire: ,       , 
+	inline size_t use_count() const noexcept { return refs.load(std::memory_order_relaxed); }
+};
+
+class MyPlainRefCount {														//    :       
+private:
+	size_t refs;
+public:
+	inline MyPlainRefCount() noexcept : refs{ 1 } {}
+	MyPlainRefCount(const MyPlainRefCount&) = delete;
+	MyPlainRefCount& operator=(const MyPlainRefCount&) = delete;
+public:
+	inline void acquire() noexcept { ++refs; }
+	inline bool release() noexcept { return --refs == 0; }
+	inline bool unique() const noexcept { return refs == 1; }
+	inline size_t use_count() const noexcept { return refs; }
+};
+#endif	//MyListRefCount_H
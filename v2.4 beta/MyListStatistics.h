@@ -0,0 +1,64 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#pragma once
+#ifndef MyListStatistics_H
+#define MyListStatistics_H
+#include <cstddef>
+#include <atomic>								//     
+
+#ifdef MYLIST_STATISTICS														//        
+#define MYLIST_STAT(statement) statement
+#else
+#define MYLIST_STAT(statement)
+#endif
+
+struct MyListAllocatorStatistics {											//   MyListAllocator
+	size_t pages;															//,  
+	size_t bytes_reserved;													//   
+	size_t allocated_blocks;
+	size_t used_blocks;
+	size_t free_blocks;														//   
+	size_t reserve_calls;
+	size_t pages_allocated;													//    
+	size_t pages_released;
+};
+
+class MyListStatistics {													//        
+public:
+	using PageHook = void (*)(const void* page, size_t bytes, void* context);
+	using DetachHook = void (*)(size_t copied_elements, void* context);	//        
+	struct Hooks {
+		PageHook on_page_allocated{ nullptr };
+		PageHook on_page_released{ nullptr };
+		DetachHook on_detach{ nullptr };
+		void* context{ nullptr };
+	};
+	struct Detaches {
+		size_t count;														// detach_helper    
+		size_t copied_elements;
+	};
+public:
+	static inline void set_hooks(const Hooks& new_hooks) noexcept { hooks() = new_hooks; }	//     
+	static inline Detaches detaches() noexcept
+	{ return { counters().detaches.load(std::memory_order_relaxed), counters().copied_elements.load(std::memory_order_relaxed) }; }
+	static inline void reset_detaches() noexcept
+	{ counters().detaches.store(0, std::memory_order_relaxed); counters().copied_elements.store(0, std::memory_order_relaxed); }
+public:																		//   
+	static inline void page_allocated(const void* page, size_t bytes) noexcept { if (hooks().on_page_allocated) hooks().on_page_allocated(page, bytes, hooks().context); }
+	static inline void page_released(const void* page, size_t bytes) noexcept { if (hooks().on_page_released) hooks().on_page_released(page, bytes, hooks().context); }
+	static inline void detached(size_t copied_elements) noexcept {
+		counters().detaches.fetch_add(1, std::memory_order_relaxed);
+		counters().copied_elements.fetch_add(copied_elements, std::memory_order_relaxed);
+		if (hooks().on_detach)
+			hooks().on_detach(copied_elements, hooks().context);
+	}
+private:
+	struct Counters {
+		std::atomic<size_t> detaches{ 0 };
+		std::atomic<size_t> copied_elements{ 0 };
+	};
+	static inline Hooks& hooks() noexcept { static Hooks instance; return instance; }
+	static inline Counters& counters() noexcept { static Counters instance; return instance; }
+};
+#endif	//MyListStatistics_H
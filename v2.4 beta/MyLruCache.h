@@ -0,0 +1,246 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#pragma once
+#ifndef MyLruCache_H
+#define MyLruCache_H
+#include "MyListAllocator.h"					//   - -    
+#include <vector>								// 
+#include <functional>							// std::hash  std::equal_to
+#include <utility>								// std::forward
+#include <iterator>
+#ifndef CONTAINER_VERIFY
+#ifdef _STL_VERIFY
+#define CONTAINER_VERIFY(cond, what) _STL_VERIFY(cond, what)
+#else
+#include <cassert>
+#define CONTAINER_VERIFY(cond, what) assert((cond) && what)
+#endif
+#endif
+
+template <class Key, class Value, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+class MyLruCache {															//      .    :    (p, n),
+public:																		//  - (chain)    -    MyListAllocator
+	using key_type = Key;
+	using mapped_type = Value;
+	using size_type = size_t;
+	class const_iterator;
+private:
+	struct BaseNode;
+	struct Node;
+	using Allocator = MyListAllocator<Node>;
+private:
+	Allocator alc;
+	Node* my_end;															// : my_end->n -   , my_end->p -   
+	std::vector<Node*> buckets;												// -  
+	size_t my_size;
+	size_t my_capacity;
+	Hash hasher;
+	KeyEqual equal;
+public:
+	explicit MyLruCache(size_t capacity, MyPageSource* page_source = MyPageSource::default_source());
+	MyLruCache(const MyLruCache&) = delete;
+	MyLruCache& operator=(const MyLruCache&) = delete;
+	inline MyLruCache(MyLruCache&& o) noexcept													//       
+		: alc{ std::move(o.alc) }, my_end{ o.my_end }, buckets{ std::move(o.buckets) }, my_size{ o.my_size }, my_capacity{ o.my_capacity }, hasher{ std::move(o.hasher) }, equal{ std::move(o.equal) }
+	{ o.my_end = nullptr; o.my_size = 0; }
+	inline ~MyLruCache() noexcept { if (my_end) destroy_entries(); }
+public:
+	inline size_t size() const noexcept { return my_size; }
+	inline size_t capacity() const noexcept { return my_capacity; }
+	inline bool empty() const noexcept { return my_size == 0; }
+	inline bool full() const noexcept { return my_size == my_capacity; }
+	inline MyListAllocatorStatistics allocator_statistics() const noexcept { return alc.statistics(); }
+	void set_capacity(size_t capacity);										//   
+public:
+	Value* get(const Key& key);												//    . nullptr - 
+	inline const Value* peek(const Key& key) const { const Node* node{ find_node(key, hasher(key)) }; return node ? &node->value : nullptr; }	//  
+	inline bool contains(const Key& key) const { return find_node(key, hasher(key)) != nullptr; }
+	inline bool touch(const Key& key) { return get(key) != nullptr; }	//   ,   
+
+	template <class K, class ...Types> Value& put(K&& key, Types&&... Args);	//   .       
+	bool erase(const Key& key);
+	bool evict() noexcept;													//   . false -  
+	void clear() noexcept;
+
+	inline const Key& lru_key() const noexcept { CONTAINER_VERIFY(!(empty()), "Empty cache"); return my_end->p->key; }
+	inline const Key& mru_key() const noexcept { CONTAINER_VERIFY(!(empty()), "Empty cache"); return my_end->n->key; }
+public:																		//       ,   
+	inline const_iterator begin() const noexcept { return const_iterator(my_end->n); }
+	inline const_iterator end() const noexcept { return const_iterator(my_end); }
+	inline const_iterator cbegin() const noexcept { return begin(); }
+	inline const_iterator cend() const noexcept { return end(); }
+private:
+	static inline size_t bucket_count_for(size_t capacity) noexcept { size_t count{ 1 }; while (count < capacity) count <<= 1; return count; }	//    1
+	inline Node*& bucket(size_t hash) noexcept { return buckets[hash & (buckets.size() - 1)]; }
+	const Node* find_node(const Key& key, size_t hash) const noexcept;
+	inline Node* find_node(const Key& key, size_t hash) noexcept { return const_cast<Node*>(static_cast<const MyLruCache*>(this)->find_node(key, hash)); }
+	static inline void unlink(Node* node) noexcept { node->p->n = node->n; node->n->p = node->p; }
+	inline void link_front(Node* node) noexcept { node->p = my_end; node->n = my_end->n; my_end->n->p = node; my_end->n = node; }
+	void unchain(Node* node) noexcept;										//   
+	void remove_node(Node* node) noexcept;
+	void rehash(size_t bucket_count);
+	void destroy_entries() noexcept;
+public:
+	class const_iterator {
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = MyLruCache::mapped_type;
+		using difference_type = ptrdiff_t;
+		using pointer = const value_type*;
+		using reference = const value_type&;
+	private:
+		friend class MyLruCache;
+		const Node* my_node;
+		inline explicit const_iterator(const Node* node) noexcept : my_node{ node } {}
+	public:
+		inline const_iterator() noexcept : my_node{ nullptr } {}
+		inline const_iterator& operator++() noexcept { my_node = my_node->n; return *this; }
+		inline const_iterator& operator--() noexcept { my_node = my_node->p; return *this; }
+		inline const_iterator operator++(int) noexcept { const_iterator temp{ *this }; my_node = my_node->n; return temp; }
+		inline const_iterator operator--(int) noexcept { const_iterator temp{ *this }; my_node = my_node->p; return temp; }
+		inline bool operator==(const const_iterator& o) const noexcept { return my_node == o.my_node; }
+		inline bool operator!=(const const_iterator& o) const noexcept { return my_node != o.my_node; }
+		inline const Key& key() const noexcept { return my_node->key; }
+		inline const Value& value() const noexcept { return my_node->value; }
+		inline const Value& operator*() const noexcept { return my_node->value; }
+		inline const Value* operator->() const noexcept { return &my_node->value; }
+	};
+private:
+	struct BaseNode {
+		Node* p, * n;
+	};
+	struct Node : public BaseNode {
+		Node* chain;														//    
+		size_t hash;														//,       Hash 
+		Key key;
+		Value value;
+		template <class K, class ...Types>
+		inline Node(size_t key_hash, K&& new_key, Types&&... Args) : BaseNode{ nullptr, nullptr }, chain{ nullptr }, hash{ key_hash }, key(std::forward<K>(new_key)), value(std::forward<Types>(Args)...) {}
+	};
+};
+
+template <class Key, class Value, class Hash, class KeyEqual>
+MyLruCache<Key, Value, Hash, KeyEqual>::MyLruCache(size_t capacity, MyPageSource* page_source)
+	: alc{ page_source }, my_end{ nullptr }, buckets(bucket_count_for(capacity), nullptr), my_size{ 0 }, my_capacity{ capacity } {
+	CONTAINER_VERIFY(capacity > 0, "Cache capacity can't be zero");
+	my_end = reinterpret_cast<Node*>(new (alc.allocate()) BaseNode{ nullptr, nullptr });	// -   ,   MyLinkedList
+	my_end->p = my_end;
+	my_end->n = my_end;
+	alc.reserve(capacity + 1);												//  -  ,    .     
+}
+
+template <class Key, class Value, class Hash, class KeyEqual>
+const typename MyLruCache<Key, Value, Hash, KeyEqual>::Node* MyLruCache<Key, Value, Hash, KeyEqual>::find_node(const Key& key, size_t hash) const noexcept {
+	for (const Node* node = buckets[hash & (buckets.size() - 1)]; node; node = node->chain)
+		if (node->hash == hash && equal(node->key, key))
+			return node;
+	return nullptr;
+}
+
+template <class Key, class Value, class Hash, class KeyEqual>
+Value* MyLruCache<Key, Value, Hash, KeyEqual>::get(const Key& key) {
+	Node* node{ find_node(key, hasher(key)) };
+	if (!node)
+		return nullptr;
+	if (node != my_end->n)
+	{
+		unlink(node);
+		link_front(node);
+	}
+	return &node->value;
+}
+
+template <class Key, class Value, class Hash, class KeyEqual>
+template <class K, class ...Types>
+Value& MyLruCache<Key, Value, Hash, KeyEqual>::put(K&& key, Types&&... Args) {
+	size_t hash{ hasher(key) };
+	if (Node* node = find_node(key, hash))									//   
+	{
+		node->value = Value(std::forward<Types>(Args)...);
+		unlink(node);
+		link_front(node);
+		return node->value;
+	}
+	Node* node{ new (alc.allocate()) Node(hash, std::forward<K>(key), std::forward<Types>(Args)...) };	// :     
+	if (my_size == my_capacity)
+		remove_node(my_end->p);												//      
+	Node*& head{ bucket(hash) };
+	node->chain = head;
+	head = node;
+	link_front(node);
+	++my_size;
+	return node->value;
+}
+
+template <class Key, class Value, class Hash, class KeyEqual>
+bool MyLruCache<Key, Value, Hash, KeyEqual>::erase(const Key& key) {
+	Node* node{ find_node(key, hasher(key)) };
+	if (!node)
+		return false;
+	remove_node(node);
+	return true;
+}
+
+template <class Key, class Value, class Hash, class KeyEqual>
+bool MyLruCache<Key, Value, Hash, KeyEqual>::evict() noexcept {
+	if (!my_size)
+		return false;
+	remove_node(my_end->p);
+	return true;
+}
+
+template <class Key, class Value, class Hash, class KeyEqual>
+void MyLruCache<Key, Value, Hash, KeyEqual>::unchain(Node* node) noexcept {
+	Node** link{ &bucket(node->hash) };
+	while (*link != node)
+		link = &(*link)->chain;
+	*link = node->chain;
+}
+
+template <class Key, class Value, class Hash, class KeyEqual>
+void MyLruCache<Key, Value, Hash, KeyEqual>::remove_node(Node* node) noexcept {
+	unchain(node);
+	unlink(node);
+	node->~Node();
+	alc.deallocate(node);
+	--my_size;
+}
+
+template <class Key, class Value, class Hash, class KeyEqual>
+void MyLruCache<Key, Value, Hash, KeyEqual>::set_capacity(size_t capacity) {
+	CONTAINER_VERIFY(capacity > 0, "Cache capacity can't be zero");
+	while (my_size > capacity)
+		remove_node(my_end->p);
+	if (bucket_count_for(capacity) > buckets.size())
+		rehash(bucket_count_for(capacity));
+	my_capacity = capacity;
+}
+
+template <class Key, class Value, class Hash, class KeyEqual>
+void MyLruCache<Key, Value, Hash, KeyEqual>::rehash(size_t bucket_count) {
+	std::vector<Node*> new_buckets(bucket_count, nullptr);
+	for (Node* node = my_end->n; node != my_end; node = node->n)			//     
+	{
+		Node*& head{ new_buckets[node->hash & (bucket_count - 1)] };
+		node->chain = head;
+		head = node;
+	}
+	buckets.swap(new_buckets);
+}
+
+template <class Key, class Value, class Hash, class KeyEqual>
+void MyLruCache<Key, Value, Hash, KeyEqual>::destroy_entries() noexcept {
+	for (Node* node = my_end->n, *next; node != my_end; node = next)
+	{
+		next = node->n;
+		node->~Node();
+	}
+}
+
+template <class Key, class Value, class Hash, class KeyEqual>
+void MyLruCache<Key, Value, Hash, KeyEqual>::clear() noexcept {
+	while (my_size)
+		remove_node(my_end->p);
+}
+#endif	//MyLruCache_H
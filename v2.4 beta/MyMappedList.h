@@ -0,0 +1,602 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#pragma once
+#ifndef MyMappedList_H
+#define MyMappedList_H
+#include <cstddef>
+#include <cstdint>
+#include <cstring>								// std::memcmp   
+#include <new>									// std::bad_alloc
+#include <utility>								// std::forward
+#include <iterator>
+#include <type_traits>
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>							//CreateFileMapping/MapViewOfFile
+#else
+#include <sys/mman.h>							//mmap/msync
+#include <sys/stat.h>							// fstat
+#include <sys/file.h>							//flock
+#include <fcntl.h>
+#include <unistd.h>								//ftruncate, sysconf
+#endif
+#ifndef CONTAINER_VERIFY
+#ifdef _STL_VERIFY
+#define CONTAINER_VERIFY(cond, what) _STL_VERIFY(cond, what)
+#else
+#include <cassert>
+#define CONTAINER_VERIFY(cond, what) assert((cond) && what)
+#endif
+#endif
+
+class MyMappedFile {														//,     (MAP_SHARED).   
+public:																		//     
+	enum class Mode { read_only, read_write, create };						//read_write  ,   ; create -    
+private:
+#ifdef _WIN32
+	HANDLE file{ INVALID_HANDLE_VALUE };
+	HANDLE mapping{ nullptr };
+#else
+	int fd{ -1 };
+#endif
+	unsigned char* my_data{ nullptr };
+	size_t my_size{ 0 };
+	bool writable{ false };
+public:
+	inline MyMappedFile() noexcept = default;
+	MyMappedFile(const MyMappedFile&) = delete;
+	MyMappedFile& operator=(const MyMappedFile&) = delete;
+	inline MyMappedFile(MyMappedFile&& o) noexcept { swap(o); }
+	inline MyMappedFile& operator=(MyMappedFile&& o) noexcept { if (this != &o) { close(); swap(o); } return *this; }
+	inline ~MyMappedFile() noexcept { close(); }
+public:
+	bool open(const char* path, Mode mode) noexcept;						//   : data() == nullptr   resize().
+																			//    ,  - ;
+																			//false,      (   )
+	bool resize(size_t bytes) noexcept;										//false -        ,   
+	bool sync() noexcept;													//     
+	void close() noexcept;
+	void swap(MyMappedFile& o) noexcept;
+	inline bool is_open() const noexcept;
+	inline bool is_writable() const noexcept { return writable; }
+	inline unsigned char* data() const noexcept { return my_data; }
+	inline size_t size() const noexcept { return my_size; }
+	static size_t granularity() noexcept;									//  :    
+private:
+	bool map() noexcept;
+	void unmap() noexcept;
+};
+
+inline bool MyMappedFile::is_open() const noexcept {
+#ifdef _WIN32
+	return file != INVALID_HANDLE_VALUE;
+#else
+	return fd != -1;
+#endif
+}
+
+inline void MyMappedFile::swap(MyMappedFile& o) noexcept {
+#ifdef _WIN32
+	std::swap(file, o.file);
+	std::swap(mapping, o.mapping);
+#else
+	std::swap(fd, o.fd);
+#endif
+	std::swap(my_data, o.my_data);
+	std::swap(my_size, o.my_size);
+	std::swap(writable, o.writable);
+}
+
+inline size_t MyMappedFile::granularity() noexcept {
+#ifdef _WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return info.dwAllocationGranularity;
+#else
+	return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+inline bool MyMappedFile::open(const char* path, Mode mode) noexcept {
+	close();
+	writable = mode != Mode::read_only;
+#ifdef _WIN32
+	file = CreateFileA(path, writable ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ, FILE_SHARE_READ, nullptr,
+		writable ? OPEN_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);	//    : create     
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+	OVERLAPPED lock_range{};												//     ,    -  
+	lock_range.Offset = MAXDWORD;
+	lock_range.OffsetHigh = MAXDWORD;
+	LARGE_INTEGER bytes;
+	if (!LockFileEx(file, LOCKFILE_FAIL_IMMEDIATELY | (writable ? LOCKFILE_EXCLUSIVE_LOCK : 0), 0, 1, 0, &lock_range)
+		|| (mode == Mode::create && !SetEndOfFile(file)) || !GetFileSizeEx(file, &bytes))
+	{
+		close();
+		return false;
+	}
+	my_size = static_cast<size_t>(bytes.QuadPart);
+#else
+	fd = ::open(path, writable ? O_RDWR | O_CREAT : O_RDONLY, 0644);		//    : create     
+	if (fd == -1)
+		return false;
+	struct stat info;
+	if (flock(fd, (writable ? LOCK_EX : LOCK_SH) | LOCK_NB) != 0 || (mode == Mode::create && ftruncate(fd, 0) != 0) || fstat(fd, &info) != 0)
+	{
+		close();
+		return false;
+	}
+	my_size = static_cast<size_t>(info.st_size);
+#endif
+	if (my_size && !map())
+	{
+		close();
+		return false;
+	}
+	return true;
+}
+
+inline bool MyMappedFile::map() noexcept {
+#ifdef _WIN32
+	mapping = CreateFileMappingA(file, nullptr, writable ? PAGE_READWRITE : PAGE_READONLY, static_cast<DWORD>(static_cast<std::uint64_t>(my_size) >> 32), static_cast<DWORD>(my_size), nullptr);
+	if (!mapping)
+		return false;
+	my_data = static_cast<unsigned char*>(MapViewOfFile(mapping, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, my_size));
+	if (!my_data)
+	{
+		CloseHandle(mapping);
+		mapping = nullptr;
+		return false;
+	}
+#else
+	void* view{ mmap(nullptr, my_size, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0) };
+	if (view == MAP_FAILED)
+		return false;
+	my_data = static_cast<unsigned char*>(view);
+#endif
+	return true;
+}
+
+inline void MyMappedFile::unmap() noexcept {
+	if (!my_data)
+		return;
+#ifdef _WIN32
+	UnmapViewOfFile(my_data);
+	CloseHandle(mapping);
+	mapping = nullptr;
+#else
+	munmap(my_data, my_size);
+#endif
+	my_data = nullptr;
+}
+
+inline bool MyMappedFile::resize(size_t bytes) noexcept {
+	if (!writable)
+		return false;
+	size_t old_size{ my_size };
+	unmap();
+#ifdef _WIN32
+	LARGE_INTEGER position;
+	position.QuadPart = static_cast<LONGLONG>(bytes);
+	bool resized{ SetFilePointerEx(file, position, nullptr, FILE_BEGIN) && SetEndOfFile(file) };
+#else
+	bool resized{ ftruncate(fd, static_cast<off_t>(bytes)) == 0 };
+#endif
+	if (resized)
+	{
+		my_size = bytes;
+		if (!my_size || map())
+			return true;
+	}
+	my_size = old_size;														//   :     
+	if (my_size)
+		map();
+	return false;
+}
+
+inline bool MyMappedFile::sync() noexcept {
+	if (!my_data || !writable)
+		return true;
+#ifdef _WIN32
+	return FlushViewOfFile(my_data, 0) && FlushFileBuffers(file);
+#else
+	return msync(my_data, my_size, MS_SYNC) == 0;
+#endif
+}
+
+inline void MyMappedFile::close() noexcept {
+	unmap();
+	my_size = 0;
+#ifdef _WIN32
+	if (file != INVALID_HANDLE_VALUE)
+	{
+		OVERLAPPED lock_range{};											//      CloseHandle   
+		lock_range.Offset = MAXDWORD;
+		lock_range.OffsetHigh = MAXDWORD;
+		UnlockFileEx(file, 0, 1, 0, &lock_range);
+		CloseHandle(file);
+	}
+	file = INVALID_HANDLE_VALUE;
+#else
+	if (fd != -1)
+		::close(fd);														// flock     
+	fd = -1;
+#endif
+}
+
+template <class T>
+class MyMappedList {														//,      .  -    ,   Node*,
+	static_assert(std::is_trivially_copyable<T>::value, "Mapped list stores raw element bytes in the file");	//      :
+public:																		//     O(1),   
+	using value_type = T;
+	using size_type = size_t;
+	using difference_type = std::ptrdiff_t;
+	using reference = value_type&;
+	using const_reference = const value_type&;
+	using pointer = value_type*;
+	using const_pointer = const value_type*;
+	using offset_type = std::uint64_t;										//0 -  :     
+	using Mode = MyMappedFile::Mode;
+	class iterator;
+	class const_iterator;
+	using reverse_iterator = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+private:
+	struct Header {															// .   MemoryPage  : top -  offset,   - size
+		char magic[4];
+		std::uint32_t byte_order;											//,       ,  
+		std::uint64_t value_size;
+		std::uint64_t value_align;
+		std::uint64_t state;												//writing,     .   -  ,
+																			// state   : ,   ,  
+		std::uint64_t size;
+		offset_type top;													//   
+		offset_type free;													//  
+	};
+	struct Link {
+		offset_type p, n;
+	};
+	struct Node : public Link {
+		T val;
+		template<class ...Types>
+		inline Node(offset_type prev, offset_type next, Types&&... Args) : Link{ prev, next }, val(std::forward<Types>(Args)...) {}
+	};
+	struct FreeBlock {														//   -   
+		offset_type prev;
+	};
+	static constexpr char image_magic[4]{ 'M', 'L', 'M', '1' };
+	static constexpr std::uint32_t image_byte_order{ 0x01020304 };
+	static constexpr std::uint64_t state_closed{ 0 }, state_writing{ 1 };
+	static constexpr offset_type end_offset{ (sizeof(Header) + alignof(Node) - 1) / alignof(Node) * alignof(Node) };	// -    
+	static constexpr size_t block_size{ sizeof(Node) };
+	static constexpr size_t min_allocated_blocks{ 64 };
+private:
+	MyMappedFile file;
+public:
+	inline MyMappedList() noexcept = default;
+	inline explicit MyMappedList(const char* path, Mode mode = Mode::read_write) { open(path, mode); }	// - is_open()
+	MyMappedList(const MyMappedList&) = delete;
+	MyMappedList& operator=(const MyMappedList&) = delete;
+	inline MyMappedList(MyMappedList&&) noexcept = default;
+	inline MyMappedList& operator=(MyMappedList&& o) noexcept { if (this != &o) { close(); file = std::move(o.file); } return *this; }
+	inline ~MyMappedList() noexcept { close(); }
+public:
+	bool open(const char* path, Mode mode = Mode::read_write);				//  . false -   ,     T,
+																			//      (    )
+	void close() noexcept;													//   ,   
+	bool flush() noexcept;													//   
+	inline bool is_open() const noexcept { return file.data() != nullptr; }
+	inline bool is_read_only() const noexcept { return !file.is_writable(); }	//    .      
+	inline size_t size() const noexcept { return is_open() ? static_cast<size_t>(header()->size) : 0; }
+	inline bool empty() const noexcept { return size() == 0; }
+	inline bool isEmpty() const noexcept { return empty(); }
+	inline size_t capacity() const noexcept { return is_open() ? static_cast<size_t>((file.size() - end_offset) / block_size - 1) : 0; }	//    
+	inline size_t file_size() const noexcept { return file.size(); }
+	void reserve(size_t count);												//        -   std::vector
+public:
+	template<class ...Types> inline void emplace_back(Types&&... Args) { verify_writable(); emplace_helper(node(end_offset)->p, end_offset, std::forward<Types>(Args)...); }
+	template<class ...Types> inline void emplace_front(Types&&... Args) { verify_writable(); emplace_helper(end_offset, node(end_offset)->n, std::forward<Types>(Args)...); }
+	inline void push_back(const T& val) { emplace_back(val); }
+	inline void push_front(const T& val) { emplace_front(val); }
+	inline void append(const T& val) { emplace_back(val); }
+	inline void prepend(const T& val) { emplace_front(val); }
+	template<class Range> void append_range(const Range& range);			//   
+	void pop_back() noexcept;
+	void pop_front() noexcept;
+	inline void removeFirst() noexcept { pop_front(); }
+	inline void removeLast() noexcept { pop_back(); }
+
+	template<class ...Types> iterator emplace(const_iterator before, Types&&... Args);
+	inline iterator insert(const_iterator before, const T& val) { return emplace(before, val); }
+	iterator erase(const_iterator pos) noexcept;
+	iterator erase(const_iterator first, const_iterator last) noexcept;
+	void clear() noexcept;													//O(1): T  ,    .    
+public:
+	inline T& front() noexcept { CONTAINER_VERIFY(!(empty()), "Empty list"); return node(node(end_offset)->n)->val; }
+	inline T& first() noexcept { return front(); }
+	inline T& back() noexcept { CONTAINER_VERIFY(!(empty()), "Empty list"); return node(node(end_offset)->p)->val; }
+	inline T& last() noexcept { return back(); }
+	inline const T& front() const noexcept { CONTAINER_VERIFY(!(empty()), "Empty list"); return node(node(end_offset)->n)->val; }
+	inline const T& first() const noexcept { return front(); }
+	inline const T& back() const noexcept { CONTAINER_VERIFY(!(empty()), "Empty list"); return node(node(end_offset)->p)->val; }
+	inline const T& last() const noexcept { return back(); }
+public:
+	inline iterator begin() noexcept { return iterator(file.data(), node(node(end_offset)->n)); }
+	inline iterator end() noexcept { return iterator(file.data(), node(end_offset)); }
+	inline const_iterator begin() const noexcept { return const_iterator(file.data(), node(node(end_offset)->n)); }
+	inline const_iterator end() const noexcept { return const_iterator(file.data(), node(end_offset)); }
+	inline const_iterator cbegin() const noexcept { return begin(); }
+	inline const_iterator cend() const noexcept { return end(); }
+	inline reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+	inline reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+	inline const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+	inline const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+	inline const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+	inline const_reverse_iterator crend() const noexcept { return rend(); }
+	inline const MyMappedList& as_const() const noexcept { return *this; }	// ,    
+private:
+	inline Header* header() const noexcept { return reinterpret_cast<Header*>(file.data()); }
+	inline Node* node(offset_type offset) const noexcept { return reinterpret_cast<Node*>(file.data() + offset); }
+	inline offset_type offset_of(const Node* target) const noexcept { return static_cast<offset_type>(reinterpret_cast<const unsigned char*>(target) - file.data()); }
+	inline void verify_writable() const noexcept { CONTAINER_VERIFY(is_open() && !is_read_only(), "List is not open for writing"); }
+	bool format();															// :   
+	bool valid_image() const noexcept;
+	void grow(size_t blocks);												//    blocks . std::bad_alloc,    
+	offset_type allocate_block();											// :  -  ,   MyListAllocator
+	void deallocate_block(offset_type block) noexcept;
+	template<class ...Types> offset_type emplace_helper(offset_type prev, offset_type next, Types&&... Args);	//,   :     
+	void displace_helper(offset_type target) noexcept;
+public:
+	class iterator {														//  :    -  
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = MyMappedList::value_type;
+		using difference_type = ptrdiff_t;
+		using pointer = MyMappedList::pointer;
+		using reference = MyMappedList::reference;
+	private:
+		friend class MyMappedList;
+		unsigned char* my_base;
+		Node* my_node;
+		inline iterator(unsigned char* base, Node* node) noexcept : my_base{ base }, my_node{ node } {}
+	public:
+		inline iterator() noexcept : my_base{ nullptr }, my_node{ nullptr } {}
+		inline iterator& operator++() noexcept { my_node = reinterpret_cast<Node*>(my_base + my_node->n); return *this; }
+		inline iterator& operator--() noexcept { my_node = reinterpret_cast<Node*>(my_base + my_node->p); return *this; }
+		inline iterator operator++(int) noexcept { iterator it{ *this }; ++(*this); return it; }
+		inline iterator operator--(int) noexcept { iterator it{ *this }; --(*this); return it; }
+		inline bool operator==(const iterator& o) const noexcept { return my_node == o.my_node; }
+		inline bool operator!=(const iterator& o) const noexcept { return my_node != o.my_node; }
+		inline T& operator*() const noexcept { CONTAINER_VERIFY(reinterpret_cast<unsigned char*>(my_node) != my_base + end_offset, "Can't dereference end iterator"); return my_node->val; }
+		inline T* operator->() const noexcept { return std::addressof(**this); }
+	};
+
+	class const_iterator {
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = MyMappedList::value_type;
+		using difference_type = ptrdiff_t;
+		using pointer = MyMappedList::const_pointer;
+		using reference = MyMappedList::const_reference;
+	private:
+		friend class MyMappedList;
+		const unsigned char* my_base;
+		const Node* my_node;
+		inline const_iterator(const unsigned char* base, const Node* node) noexcept : my_base{ base }, my_node{ node } {}
+	public:
+		inline const_iterator() noexcept : my_base{ nullptr }, my_node{ nullptr } {}
+		inline const_iterator(const iterator& it) noexcept : my_base{ it.my_base }, my_node{ it.my_node } {}
+		inline const_iterator& operator++() noexcept { my_node = reinterpret_cast<const Node*>(my_base + my_node->n); return *this; }
+		inline const_iterator& operator--() noexcept { my_node = reinterpret_cast<const Node*>(my_base + my_node->p); return *this; }
+		inline const_iterator operator++(int) noexcept { const_iterator it{ *this }; ++(*this); return it; }
+		inline const_iterator operator--(int) noexcept { const_iterator it{ *this }; --(*this); return it; }
+		inline bool operator==(const const_iterator& o) const noexcept { return my_node == o.my_node; }
+		inline bool operator!=(const const_iterator& o) const noexcept { return my_node != o.my_node; }
+		inline const T& operator*() const noexcept { CONTAINER_VERIFY(reinterpret_cast<const unsigned char*>(my_node) != my_base + end_offset, "Can't dereference end iterator"); return my_node->val; }
+		inline const T* operator->() const noexcept { return std::addressof(**this); }
+	};
+};
+
+template <class T>
+bool MyMappedList<T>::open(const char* path, Mode mode) {
+	close();
+	if (!file.open(path, mode))
+		return false;
+	if (file.is_writable() && !file.size())									//   
+	{
+		if (!format())
+		{
+			file.close();
+			return false;
+		}
+	}
+	else if (!valid_image())
+	{
+		file.close();
+		return false;
+	}
+	if (file.is_writable())
+	{
+		header()->state = state_writing;									//  ,   ,      
+		file.sync();
+	}
+	return true;
+}
+
+template <class T>
+bool MyMappedList<T>::format() {
+	size_t granularity{ MyMappedFile::granularity() };
+	size_t bytes{ (end_offset + block_size * (1 + min_allocated_blocks) + granularity - 1) / granularity * granularity };
+	if (!file.resize(bytes))
+		return false;
+	Header* h{ header() };
+	std::memcpy(h->magic, image_magic, sizeof(image_magic));
+	h->byte_order = image_byte_order;
+	h->value_size = sizeof(T);
+	h->value_align = alignof(T);
+	h->state = state_closed;
+	h->size = 0;
+	h->top = end_offset + block_size;
+	h->free = 0;
+	Link* end{ reinterpret_cast<Link*>(file.data() + end_offset) };
+	end->p = end_offset;
+	end->n = end_offset;
+	return true;
+}
+
+template <class T>
+bool MyMappedList<T>::valid_image() const noexcept {						//O(1):   
+	if (!file.data() || file.size() < end_offset + block_size)
+		return false;
+	const Header* h{ header() };
+	return !std::memcmp(h->magic, image_magic, sizeof(image_magic)) && h->byte_order == image_byte_order && h->value_size == sizeof(T) && h->value_align == alignof(T)
+		&& h->state == state_closed && h->top >= end_offset + block_size && h->top <= file.size() && (h->top - end_offset) % block_size == 0
+		&& h->size < (h->top - end_offset) / block_size && (!h->free || (h->free >= end_offset + block_size && h->free < h->top));
+}
+
+template <class T>
+void MyMappedList<T>::close() noexcept {
+	if (is_open() && file.is_writable())
+	{
+		header()->state = state_closed;
+		file.sync();
+	}
+	file.close();
+}
+
+template <class T>
+bool MyMappedList<T>::flush() noexcept {
+	if (!is_open() || !file.is_writable())
+		return is_open();
+	header()->state = state_closed;											//     -      
+	bool synced{ file.sync() };
+	header()->state = state_writing;
+	return synced;
+}
+
+template <class T>
+void MyMappedList<T>::grow(size_t blocks) {
+	size_t used{ static_cast<size_t>((header()->top - end_offset) / block_size) };
+	size_t new_blocks{ blocks > used ? blocks : used };						//  -   MyListAllocator  reserve_multiplier == 1
+	size_t granularity{ MyMappedFile::granularity() };
+	size_t bytes{ (static_cast<size_t>(header()->top) + new_blocks * block_size + granularity - 1) / granularity * granularity };
+	if (bytes > file.size() && !file.resize(bytes))
+		throw std::bad_alloc();
+}
+
+template <class T>
+void MyMappedList<T>::reserve(size_t count) {
+	verify_writable();
+	size_t fits{ static_cast<size_t>((file.size() - header()->top) / block_size) };
+	if (count > size() + fits)
+		grow(count - size());
+}
+
+template <class T>
+typename MyMappedList<T>::offset_type MyMappedList<T>::allocate_block() {
+	if (offset_type block = header()->free)
+	{
+		header()->free = reinterpret_cast<FreeBlock*>(file.data() + block)->prev;
+		return block;
+	}
+	if (header()->top + block_size > file.size())
+		grow(1);
+	offset_type block{ header()->top };
+	header()->top += block_size;
+	return block;
+}
+
+template <class T>
+void MyMappedList<T>::deallocate_block(offset_type block) noexcept {
+	Header* h{ header() };
+	if (block + block_size == h->top)										//    
+		h->top -= block_size;
+	else
+	{
+		reinterpret_cast<FreeBlock*>(file.data() + block)->prev = h->free;
+		h->free = block;
+	}
+}
+
+template <class T>
+template <class ...Types>
+typename MyMappedList<T>::offset_type MyMappedList<T>::emplace_helper(offset_type prev, offset_type next, Types&&... Args) {
+	T val(std::forward<Types>(Args)...);									//      (l.push_back(l.front())) -    
+	offset_type block{ allocate_block() };									//      
+	new (file.data() + block) Node(prev, next, val);
+	node(prev)->n = block;
+	node(next)->p = block;
+	++header()->size;
+	return block;
+}
+
+template <class T>
+void MyMappedList<T>::displace_helper(offset_type target) noexcept {
+	Node* removed{ node(target) };
+	node(removed->p)->n = removed->n;
+	node(removed->n)->p = removed->p;
+	deallocate_block(target);
+	--header()->size;
+}
+
+template <class T>
+template <class Range>
+void MyMappedList<T>::append_range(const Range& range) {
+	reserve(size() + static_cast<size_t>(std::size(range)));
+	for (const T& val : range)
+		emplace_back(val);
+}
+
+template <class T>
+void MyMappedList<T>::pop_back() noexcept {
+	verify_writable();
+	CONTAINER_VERIFY(!(empty()), "Empty list");
+	displace_helper(node(end_offset)->p);
+}
+
+template <class T>
+void MyMappedList<T>::pop_front() noexcept {
+	verify_writable();
+	CONTAINER_VERIFY(!(empty()), "Empty list");
+	displace_helper(node(end_offset)->n);
+}
+
+template <class T>
+template <class ...Types>
+typename MyMappedList<T>::iterator MyMappedList<T>::emplace(const_iterator before, Types&&... Args) {
+	verify_writable();
+	offset_type next{ offset_of(before.my_node) };
+	offset_type block{ emplace_helper(node(next)->p, next, std::forward<Types>(Args)...) };
+	return iterator(file.data(), node(block));
+}
+
+template <class T>
+typename MyMappedList<T>::iterator MyMappedList<T>::erase(const_iterator pos) noexcept {
+	verify_writable();
+	CONTAINER_VERIFY(offset_of(pos.my_node) != end_offset, "Can't erase end iterator");
+	offset_type next{ pos.my_node->n };
+	displace_helper(offset_of(pos.my_node));								//   
+	return iterator(file.data(), node(next));
+}
+
+template <class T>
+typename MyMappedList<T>::iterator MyMappedList<T>::erase(const_iterator first, const_iterator last) noexcept {
+	while (first != last)
+		first = erase(first);
+	return iterator(file.data(), const_cast<Node*>(last.my_node));
+}
+
+template <class T>
+void MyMappedList<T>::clear() noexcept {
+	verify_writable();
+	Header* h{ header() };
+	h->size = 0;
+	h->top = end_offset + block_size;
+	h->free = 0;
+	node(end_offset)->p = end_offset;
+	node(end_offset)->n = end_offset;
+}
+#endif	//MyMappedList_H
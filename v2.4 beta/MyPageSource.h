@@ -0,0 +1,179 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#pragma once
+#ifndef MyPageSource_H
+#define MyPageSource_H
+#include <cstddef>
+#include <new>									// std::bad_alloc
+#include <memory_resource>						// std::pmr::memory_resource
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>							//VirtualAlloc/VirtualFree
+#else
+#include <sys/mman.h>							//mmap/munmap/madvise
+#include <unistd.h>								// sysconf
+#endif
+
+class MyPageSource {														//   MyListAllocator:     
+public:
+	virtual ~MyPageSource() = default;
+	virtual void* allocate_page(size_t bytes) = 0;							//     alignof(std::max_align_t)
+	virtual void deallocate_page(void* page, size_t bytes) noexcept = 0;	//bytes -   ,     
+	static MyPageSource* default_source() noexcept;							//new[]/delete[],     
+};
+
+class MyNewPageSource : public MyPageSource {
+public:
+	inline void* allocate_page(size_t bytes) override { return new unsigned char[bytes]; }
+	inline void deallocate_page(void* page, size_t) noexcept override { delete[] static_cast<unsigned char*>(page); }
+};
+
+inline MyPageSource* MyPageSource::default_source() noexcept {
+	static MyNewPageSource source;
+	return &source;
+}
+
+class MyPmrPageSource : public MyPageSource {								//  std::pmr::memory_resource
+private:
+	std::pmr::memory_resource* upstream;
+public:
+	inline explicit MyPmrPageSource(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) noexcept : upstream{ resource } {}
+	inline std::pmr::memory_resource* resource() const noexcept { return upstream; }
+	inline void* allocate_page(size_t bytes) override { return upstream->allocate(bytes, alignof(std::max_align_t)); }
+	inline void deallocate_page(void* page, size_t bytes) noexcept override { upstream->deallocate(page, bytes, alignof(std::max_align_t)); }
+};
+
+class MyMmapPageSource : public MyPageSource {								//   ,   -    (huge pages)
+private:
+	static constexpr size_t huge_page_size{ 2 * 1024 * 1024 };
+	bool huge_pages;
+	size_t min_mapping;														//           new[]
+	size_t granularity;
+public:
+	explicit MyMmapPageSource(bool use_huge_pages = false, size_t min_mapping_bytes = 64 * 1024) noexcept;
+	void* allocate_page(size_t bytes) override;
+	void deallocate_page(void* page, size_t bytes) noexcept override;
+private:
+	inline size_t mapping_size(size_t bytes) const noexcept { return (bytes + granularity - 1) / granularity * granularity; }
+};
+
+inline MyMmapPageSource::MyMmapPageSource(bool use_huge_pages, size_t min_mapping_bytes) noexcept
+	: huge_pages{ use_huge_pages }, min_mapping{ min_mapping_bytes } {
+#ifdef _WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	granularity = info.dwAllocationGranularity;
+	if (huge_pages && GetLargePageMinimum())								//MEM_LARGE_PAGES   SeLockMemoryPrivilege
+		granularity = GetLargePageMinimum();
+#else
+	granularity = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+	if (huge_pages)
+		granularity = huge_page_size;
+#endif
+}
+
+inline void* MyMmapPageSource::allocate_page(size_t bytes) {
+	if (bytes < min_mapping)
+		return MyPageSource::default_source()->allocate_page(bytes);
+	size_t length{ mapping_size(bytes) };
+#ifdef _WIN32
+	void* page{ nullptr };
+	if (huge_pages)
+		page = VirtualAlloc(nullptr, length, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+	if (!page)																//     -  
+		page = VirtualAlloc(nullptr, length, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+	if (!page)
+		throw std::bad_alloc();
+	return page;
+#else
+	if (!huge_pages)
+	{
+		void* page{ mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) };
+		if (page == MAP_FAILED)
+			throw std::bad_alloc();
+		return page;
+	}
+	size_t padded{ length + huge_page_size };								//      2 :      
+	unsigned char* raw{ static_cast<unsigned char*>(mmap(nullptr, padded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)) };
+	if (raw == MAP_FAILED)
+		throw std::bad_alloc();
+	size_t shift{ (huge_page_size - reinterpret_cast<size_t>(raw) % huge_page_size) % huge_page_size };
+	if (shift)
+		munmap(raw, shift);
+	if (huge_page_size - shift)
+		munmap(raw + shift + length, huge_page_size - shift);
+#ifdef MADV_HUGEPAGE
+	madvise(raw + shift, length, MADV_HUGEPAGE);							//  :   THP   
+#endif
+	return raw + shift;
+#endif
+}
+
+inline void MyMmapPageSource::deallocate_page(void* page, size_t bytes) noexcept {
+	if (bytes < min_mapping)
+		return MyPageSource::default_source()->deallocate_page(page, bytes);
+#ifdef _WIN32
+	VirtualFree(page, 0, MEM_RELEASE);
+#else
+	munmap(page, mapping_size(bytes));
+#endif
+}
+
+class MyMonotonicPageSource : public MyPageSource {						//      :     ,
+private:																	//     release()  .  
+	struct Chunk {
+		Chunk* prev;
+		size_t size;														//   
+	};
+	static constexpr size_t alignment{ alignof(std::max_align_t) };
+	static constexpr size_t header_size{ (sizeof(Chunk) + alignment - 1) / alignment * alignment };
+	MyPageSource* upstream;
+	size_t chunk_size;
+	Chunk* top;
+	unsigned char* cursor;
+	size_t left;
+public:
+	inline explicit MyMonotonicPageSource(size_t initial_chunk_bytes = 1024 * 1024, MyPageSource* chunk_source = MyPageSource::default_source()) noexcept
+		: upstream{ chunk_source }, chunk_size{ initial_chunk_bytes }, top{ nullptr }, cursor{ nullptr }, left{ 0 } {}
+	MyMonotonicPageSource(const MyMonotonicPageSource&) = delete;
+	MyMonotonicPageSource& operator=(const MyMonotonicPageSource&) = delete;
+	inline ~MyMonotonicPageSource() noexcept override { release(); }
+public:
+	void* allocate_page(size_t bytes) override;
+	inline void deallocate_page(void*, size_t) noexcept override {}		//      
+	void release() noexcept;												//,    ,      
+};
+
+inline void* MyMonotonicPageSource::allocate_page(size_t bytes) {
+	bytes = (bytes + alignment - 1) / alignment * alignment;
+	if (bytes > left)
+	{
+		size_t new_chunk_size{ header_size + bytes > chunk_size ? header_size + bytes : chunk_size };
+		Chunk* chunk{ static_cast<Chunk*>(upstream->allocate_page(new_chunk_size)) };
+		chunk->prev = top;
+		chunk->size = new_chunk_size;
+		top = chunk;
+		cursor = reinterpret_cast<unsigned char*>(chunk) + header_size;
+		left = new_chunk_size - header_size;
+		chunk_size *= 2;													//    -    
+	}
+	void* page{ cursor };
+	cursor += bytes;
+	left -= bytes;
+	return page;
+}
+
+inline void MyMonotonicPageSource::release() noexcept {
+	while (top)
+	{
+		Chunk* chunk{ top };
+		top = top->prev;
+		upstream->deallocate_page(chunk, chunk->size);
+	}
+	cursor = nullptr;
+	left = 0;
+}
+#endif	//MyPageSource_H
@@ -0,0 +1,487 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#pragma once
+#ifndef MyPersistentList_H
+#define MyPersistentList_H
+#include <atomic>								//  
+#include <utility>								// std::forward
+#include <iterator>
+#include <initializer_list>
+#ifndef CONTAINER_VERIFY
+#ifdef _STL_VERIFY
+#define CONTAINER_VERIFY(cond, what) _STL_VERIFY(cond, what)
+#else
+#include <cassert>
+#define CONTAINER_VERIFY(cond, what) assert((cond) && what)
+#endif
+#endif
+
+template <class T, size_t LeafCapacity = 32, size_t Branching = 32>
+class MyPersistentList {													//   :    ,
+	static_assert(LeafCapacity >= 2 && Branching >= 3, "Too small node capacity");	//         
+public:
+	using value_type = T;
+	using size_type = size_t;
+	using difference_type = std::ptrdiff_t;
+	using reference = value_type&;
+	using const_reference = const value_type&;
+	using pointer = value_type*;
+	using const_pointer = const value_type*;
+	class const_iterator;
+	using iterator = const_iterator;										// -   set()/replace(),      
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+private:
+	struct TreeNode;
+	struct Leaf;
+	struct Inner;
+	static constexpr size_t max_depth{ 24 };								//      
+private:
+	TreeNode* root;															//   new:      ,
+	size_t my_size;															//   ,   MyListAllocator   
+public:
+	inline MyPersistentList() noexcept : root{ nullptr }, my_size{ 0 } {}
+	inline MyPersistentList(const std::initializer_list<T>& init) : MyPersistentList(init.begin(), init.end()) {}
+	template <class InputIt> MyPersistentList(InputIt first, InputIt last) : MyPersistentList() { for (; first != last; ++first) push_back(*first); }
+	inline MyPersistentList(const MyPersistentList& o) noexcept : root{ retain(o.root) }, my_size{ o.my_size } {}	//O(1):   
+	inline MyPersistentList(MyPersistentList&& o) noexcept : root{ o.root }, my_size{ o.my_size } { o.root = nullptr; o.my_size = 0; }
+	inline MyPersistentList& operator=(const MyPersistentList& o) noexcept { MyPersistentList copy{ o }; swap(copy); return *this; }
+	inline MyPersistentList& operator=(MyPersistentList&& o) noexcept { MyPersistentList moved{ std::move(o) }; swap(moved); return *this; }
+	inline ~MyPersistentList() noexcept { release(root); }
+public:
+	inline size_t size() const noexcept { return my_size; }
+	inline bool empty() const noexcept { return my_size == 0; }
+	inline bool isEmpty() const noexcept { return my_size == 0; }
+	inline bool is_shared_with(const MyPersistentList& o) const noexcept { return root && root == o.root; }	//   
+	inline void swap(MyPersistentList& o) noexcept { std::swap(root, o.root); std::swap(my_size, o.my_size); }
+public:
+	const T& at(size_t index) const noexcept;								//O(log n)
+	inline const T& operator[](size_t index) const noexcept { return at(index); }
+	inline const T& front() const noexcept { CONTAINER_VERIFY(!(empty()), "Empty list"); return at(0); }
+	inline const T& first() const noexcept { return front(); }
+	inline const T& back() const noexcept { CONTAINER_VERIFY(!(empty()), "Empty list"); return at(my_size - 1); }
+	inline const T& last() const noexcept { return back(); }
+
+	template <class U> void set(size_t index, U&& val);						//      ,   
+	template <class U> inline void replace(size_t index, U&& val) { set(index, std::forward<U>(val)); }
+
+	template <class ...Types> void emplace(size_t index, Types&&... Args);
+	inline void insert(size_t index, const T& val) { emplace(index, val); }
+	inline void insert(size_t index, T&& val) { emplace(index, std::move(val)); }
+	template <class ...Types> inline void emplace_back(Types&&... Args) { emplace(my_size, std::forward<Types>(Args)...); }
+	template <class ...Types> inline void emplace_front(Types&&... Args) { emplace(0, std::forward<Types>(Args)...); }
+	inline void push_back(const T& val) { emplace_back(val); }
+	inline void push_back(T&& val) { emplace_back(std::move(val)); }
+	inline void push_front(const T& val) { emplace_front(val); }
+	inline void push_front(T&& val) { emplace_front(std::move(val)); }
+	inline void append(const T& val) { emplace_back(val); }
+	inline void append(T&& val) { emplace_back(std::move(val)); }
+	inline void prepend(const T& val) { emplace_front(val); }
+	inline void prepend(T&& val) { emplace_front(std::move(val)); }
+
+	void erase(size_t index);
+	inline void removeAt(size_t index) { erase(index); }
+	inline void pop_back() { CONTAINER_VERIFY(!(empty()), "Empty list"); erase(my_size - 1); }
+	inline void pop_front() { CONTAINER_VERIFY(!(empty()), "Empty list"); erase(0); }
+	inline void removeFirst() { pop_front(); }
+	inline void removeLast() { pop_back(); }
+	inline void clear() noexcept { release(root); root = nullptr; my_size = 0; }
+public:
+	bool contains(const T& val) const noexcept;
+	size_t count(const T& val) const noexcept;
+	bool operator==(const MyPersistentList& o) const;
+	inline bool operator!=(const MyPersistentList& o) const { return !(*this == o); }
+public:
+	inline const_iterator begin() const noexcept { return const_iterator(this, 0); }
+	inline const_iterator cbegin() const noexcept { return begin(); }
+	inline const_iterator constBegin() const noexcept { return begin(); }
+	inline const_iterator end() const noexcept { return const_iterator(this, my_size); }
+	inline const_iterator cend() const noexcept { return end(); }
+	inline const_iterator constEnd() const noexcept { return end(); }
+	inline const_reverse_iterator rbegin() const noexcept { return std::make_reverse_iterator(end()); }
+	inline const_reverse_iterator rend() const noexcept { return std::make_reverse_iterator(begin()); }
+private:
+	static inline TreeNode* retain(TreeNode* node) noexcept { if (node) node->refs.fetch_add(1, std::memory_order_relaxed); return node; }
+	static void release(TreeNode* node) noexcept;							//       
+	static TreeNode* clone(const TreeNode* node);							// :   ,    - 
+	static inline void make_unique(TreeNode*& slot)							//      
+	{ if (slot->refs.load(std::memory_order_acquire) != 1) { TreeNode* copy{ clone(slot) }; release(slot); slot = copy; } }
+	static TreeNode* insert_helper(TreeNode* node, size_t index, T& val);	//   ,    
+	static void erase_helper(TreeNode* node, size_t index);
+	template <class Visitor> static bool visit(const TreeNode* node, Visitor& visitor);	//   ,  visitor  true
+	static inline void relocate(T* dst, T* src) { new (dst) T(std::move_if_noexcept(*src)); src->~T(); }
+public:
+	class const_iterator {													//     :     -  O(1)
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = MyPersistentList::value_type;
+		using difference_type = ptrdiff_t;
+		using pointer = MyPersistentList::const_pointer;
+		using reference = MyPersistentList::const_reference;
+	private:
+		friend class MyPersistentList;
+		const MyPersistentList* my_cont;
+		size_t my_index;
+		size_t depth;														//    path
+		const TreeNode* path[max_depth];
+		size_t pos[max_depth];
+	public:
+		inline const_iterator() noexcept : my_cont{ nullptr }, my_index{ 0 }, depth{ 0 } {}
+		const_iterator(const MyPersistentList* cont, size_t index) noexcept;
+	public:
+		const_iterator& operator++() noexcept;
+		const_iterator& operator--() noexcept;
+		inline const_iterator operator++(int) noexcept { const_iterator temp{ *this }; ++(*this); return temp; }
+		inline const_iterator operator--(int) noexcept { const_iterator temp{ *this }; --(*this); return temp; }
+		inline bool operator==(const const_iterator& o) const noexcept { return my_index == o.my_index; }
+		inline bool operator!=(const const_iterator& o) const noexcept { return my_index != o.my_index; }
+		inline size_t index() const noexcept { return my_index; }
+		inline const T& operator*() const noexcept
+		{ CONTAINER_VERIFY(my_index < my_cont->my_size, "Can't dereference end iterator"); return static_cast<const Leaf*>(path[depth])->data()[pos[depth]]; }
+		inline const T* operator->() const noexcept { return std::addressof(**this); }
+	};
+private:
+	struct TreeNode {
+		std::atomic<size_t> refs;											//:     
+		size_t size;														//   
+		size_t count;														//      
+		bool leaf;
+		inline TreeNode(bool is_leaf) noexcept : refs{ 1 }, size{ 0 }, count{ 0 }, leaf{ is_leaf } {}
+	};
+	struct Leaf : TreeNode {
+		alignas(T) unsigned char storage[sizeof(T) * LeafCapacity];
+		inline Leaf() noexcept : TreeNode(true) {}
+		inline T* data() noexcept { return reinterpret_cast<T*>(storage); }
+		inline const T* data() const noexcept { return reinterpret_cast<const T*>(storage); }
+	};
+	struct Inner : TreeNode {
+		TreeNode* children[Branching];
+		inline Inner() noexcept : TreeNode(false) {}
+	};
+};
+
+template <class T, size_t LeafCapacity, size_t Branching>
+void MyPersistentList<T, LeafCapacity, Branching>::release(TreeNode* node) noexcept {
+	if (!node || node->refs.fetch_sub(1, std::memory_order_acq_rel) != 1)
+		return;
+	if (node->leaf)
+	{
+		Leaf* leaf{ static_cast<Leaf*>(node) };
+		for (size_t i = 0; i < leaf->count; ++i)
+			leaf->data()[i].~T();
+		delete leaf;
+	}
+	else
+	{
+		Inner* inner{ static_cast<Inner*>(node) };
+		for (size_t i = 0; i < inner->count; ++i)
+			release(inner->children[i]);
+		delete inner;
+	}
+}
+
+template <class T, size_t LeafCapacity, size_t Branching>
+typename MyPersistentList<T, LeafCapacity, Branching>::TreeNode* MyPersistentList<T, LeafCapacity, Branching>::clone(const TreeNode* node) {
+	if (node->leaf)
+	{
+		const Leaf* source{ static_cast<const Leaf*>(node) };
+		Leaf* copy{ new Leaf() };
+		for (; copy->count < source->count; ++copy->count)
+			new (copy->data() + copy->count) T(source->data()[copy->count]);
+		copy->size = copy->count;
+		return copy;
+	}
+	const Inner* source{ static_cast<const Inner*>(node) };
+	Inner* copy{ new Inner() };
+	for (size_t i = 0; i < source->count; ++i)
+		copy->children[i] = retain(source->children[i]);
+	copy->count = source->count;
+	copy->size = source->size;
+	return copy;
+}
+
+template <class T, size_t LeafCapacity, size_t Branching>
+const T& MyPersistentList<T, LeafCapacity, Branching>::at(size_t index) const noexcept {
+	CONTAINER_VERIFY(index < my_size, "Index out of range");
+	const TreeNode* node{ root };
+	while (!node->leaf)
+	{
+		const Inner* inner{ static_cast<const Inner*>(node) };
+		size_t i{ 0 };
+		for (; index >= inner->children[i]->size; ++i)
+			index -= inner->children[i]->size;
+		node = inner->children[i];
+	}
+	return static_cast<const Leaf*>(node)->data()[index];
+}
+
+template <class T, size_t LeafCapacity, size_t Branching>
+template <class U>
+void MyPersistentList<T, LeafCapacity, Branching>::set(size_t index, U&& val) {
+	CONTAINER_VERIFY(index < my_size, "Index out of range");
+	TreeNode** slot{ &root };
+	for (;;)
+	{
+		make_unique(*slot);
+		if ((*slot)->leaf)
+			break;
+		Inner* inner{ static_cast<Inner*>(*slot) };
+		size_t i{ 0 };
+		for (; index >= inner->children[i]->size; ++i)
+			index -= inner->children[i]->size;
+		slot = inner->children + i;
+	}
+	static_cast<Leaf*>(*slot)->data()[index] = std::forward<U>(val);
+}
+
+template <class T, size_t LeafCapacity, size_t Branching>
+template <class ...Types>
+void MyPersistentList<T, LeafCapacity, Branching>::emplace(size_t index, Types&&... Args) {
+	CONTAINER_VERIFY(index <= my_size, "Index out of range");
+	T val(std::forward<Types>(Args)...);									//       
+	if (!root)
+		root = new Leaf();
+	else
+		make_unique(root);
+	if (TreeNode* sibling = insert_helper(root, index, val))				//  -     
+	{
+		Inner* new_root{ new Inner() };
+		new_root->children[0] = root;
+		new_root->children[1] = sibling;
+		new_root->count = 2;
+		new_root->size = root->size + sibling->size;
+		root = new_root;
+	}
+	++my_size;
+}
+
+template <class T, size_t LeafCapacity, size_t Branching>
+typename MyPersistentList<T, LeafCapacity, Branching>::TreeNode* MyPersistentList<T, LeafCapacity, Branching>::insert_helper(TreeNode* node, size_t index, T& val) {
+	if (node->leaf)
+	{
+		Leaf* leaf{ static_cast<Leaf*>(node) }, * right{ nullptr };
+		if (leaf->count == LeafCapacity)
+		{
+			right = new Leaf();
+			size_t keep{ index == LeafCapacity ? LeafCapacity : LeafCapacity / 2 };	//      
+			for (size_t i = keep; i < LeafCapacity; ++i)
+				relocate(right->data() + i - keep, leaf->data() + i);
+			right->count = right->size = LeafCapacity - keep;
+			leaf->count = leaf->size = keep;
+			if (index > keep)
+			{
+				leaf = right;
+				index -= keep;
+			}
+			else if (index == keep && keep == LeafCapacity)
+			{
+				leaf = right;
+				index = 0;
+			}
+		}
+		T* cells{ leaf->data() };
+		for (size_t i = leaf->count; i > index; --i)
+			relocate(cells + i, cells + i - 1);
+		new (cells + index) T(std::move(val));
+		++leaf->count;
+		++leaf->size;
+		return right;
+	}
+	Inner* inner{ static_cast<Inner*>(node) };
+	size_t i{ 0 };
+	for (; i + 1 < inner->count && index > inner->children[i]->size; ++i)
+		index -= inner->children[i]->size;
+	make_unique(inner->children[i]);
+	TreeNode* sibling{ insert_helper(inner->children[i], index, val) };
+	++inner->size;
+	if (!sibling)
+		return nullptr;
+	Inner* right{ nullptr };
+	size_t target{ i + 1 };
+	if (inner->count == Branching)
+	{
+		right = new Inner();
+		size_t keep{ target == Branching ? Branching : Branching / 2 };
+		for (size_t k = keep; k < Branching; ++k)
+		{
+			right->children[k - keep] = inner->children[k];
+			right->size += inner->children[k]->size;
+		}
+		right->count = Branching - keep;
+		inner->count = keep;
+		inner->size -= right->size;
+		if (target > keep || (target == keep && keep == Branching))
+		{
+			inner->size -= sibling->size;									// sibling      inner
+			right->size += sibling->size;
+			inner = right;
+			target -= keep;
+		}
+	}
+	for (size_t k = inner->count; k > target; --k)
+		inner->children[k] = inner->children[k - 1];
+	inner->children[target] = sibling;
+	++inner->count;
+	return right;
+}
+
+template <class T, size_t LeafCapacity, size_t Branching>
+void MyPersistentList<T, LeafCapacity, Branching>::erase(size_t index) {
+	CONTAINER_VERIFY(index < my_size, "Index out of range");
+	make_unique(root);
+	erase_helper(root, index);
+	--my_size;
+	if (!my_size)
+	{
+		release(root);
+		root = nullptr;
+	}
+	else if (!root->leaf && root->count == 1)								//      
+	{
+		Inner* old_root{ static_cast<Inner*>(root) };
+		root = old_root->children[0];
+		delete old_root;
+	}
+}
+
+template <class T, size_t LeafCapacity, size_t Branching>
+void MyPersistentList<T, LeafCapacity, Branching>::erase_helper(TreeNode* node, size_t index) {
+	--node->size;
+	if (node->leaf)
+	{
+		Leaf* leaf{ static_cast<Leaf*>(node) };
+		T* cells{ leaf->data() };
+		cells[index].~T();
+		for (size_t i = index + 1; i < leaf->count; ++i)
+			relocate(cells + i - 1, cells + i);
+		--leaf->count;
+		return;
+	}
+	Inner* inner{ static_cast<Inner*>(node) };
+	size_t i{ 0 };
+	for (; index >= inner->children[i]->size; ++i)
+		index -= inner->children[i]->size;
+	make_unique(inner->children[i]);
+	erase_helper(inner->children[i], index);
+	if (!inner->children[i]->size)											//  ,     
+	{
+		release(inner->children[i]);
+		for (size_t k = i + 1; k < inner->count; ++k)
+			inner->children[k - 1] = inner->children[k];
+		--inner->count;
+	}
+}
+
+template <class T, size_t LeafCapacity, size_t Branching>
+template <class Visitor>
+bool MyPersistentList<T, LeafCapacity, Branching>::visit(const TreeNode* node, Visitor& visitor) {
+	if (node->leaf)
+	{
+		const Leaf* leaf{ static_cast<const Leaf*>(node) };
+		for (size_t i = 0; i < leaf->count; ++i)
+			if (!visitor(leaf->data()[i]))
+				return false;
+		return true;
+	}
+	const Inner* inner{ static_cast<const Inner*>(node) };
+	for (size_t i = 0; i < inner->count; ++i)
+		if (!visit(inner->children[i], visitor))
+			return false;
+	return true;
+}
+
+template <class T, size_t LeafCapacity, size_t Branching>
+bool MyPersistentList<T, LeafCapacity, Branching>::contains(const T& val) const noexcept {
+	bool found{ false };
+	auto visitor{ [&val, &found](const T& node_val) { found = node_val == val; return !found; } };
+	if (root)
+		visit(root, visitor);
+	return found;
+}
+
+template <class T, size_t LeafCapacity, size_t Branching>
+size_t MyPersistentList<T, LeafCapacity, Branching>::count(const T& val) const noexcept {
+	size_t count{ 0 };
+	auto visitor{ [&val, &count](const T& node_val) { count += node_val == val; return true; } };
+	if (root)
+		visit(root, visitor);
+	return count;
+}
+
+template <class T, size_t LeafCapacity, size_t Branching>
+bool MyPersistentList<T, LeafCapacity, Branching>::operator==(const MyPersistentList& o) const {
+	if (my_size != o.my_size)
+		return false;
+	if (root == o.root)														//  -   
+		return true;
+	for (const_iterator it = begin(), o_it = o.begin(); it != end(); ++it, ++o_it)
+		if (*it != *o_it)
+			return false;
+	return true;
+}
+
+template <class T, size_t LeafCapacity, size_t Branching>
+MyPersistentList<T, LeafCapacity, Branching>::const_iterator::const_iterator(const MyPersistentList* cont, size_t index) noexcept
+	: my_cont{ cont }, my_index{ index }, depth{ 0 } {
+	if (!cont->root)
+		return;
+	bool at_end{ index == cont->my_size };									// end      
+	if (at_end)
+		--index;
+	const TreeNode* node{ cont->root };
+	while (!node->leaf)
+	{
+		const Inner* inner{ static_cast<const Inner*>(node) };
+		size_t i{ 0 };
+		for (; index >= inner->children[i]->size; ++i)
+			index -= inner->children[i]->size;
+		path[depth] = node;
+		pos[depth++] = i;
+		node = inner->children[i];
+	}
+	path[depth] = node;
+	pos[depth] = index + at_end;
+}
+
+template <class T, size_t LeafCapacity, size_t Branching>
+typename MyPersistentList<T, LeafCapacity, Branching>::const_iterator& MyPersistentList<T, LeafCapacity, Branching>::const_iterator::operator++() noexcept {
+	CONTAINER_VERIFY(my_index < my_cont->my_size, "Can't increment end list iterator");
+	if (++my_index == my_cont->my_size || ++pos[depth] < path[depth]->count)
+	{
+		if (my_index == my_cont->my_size)
+			pos[depth] = path[depth]->count;
+		return *this;
+	}
+	size_t level{ depth - 1 };
+	while (pos[level] + 1 == path[level]->count)							//  ,     
+		--level;
+	++pos[level];
+	for (; level < depth; ++level)											//     
+	{
+		path[level + 1] = static_cast<const Inner*>(path[level])->children[pos[level]];
+		pos[level + 1] = 0;
+	}
+	return *this;
+}
+
+template <class T, size_t LeafCapacity, size_t Branching>
+typename MyPersistentList<T, LeafCapacity, Branching>::const_iterator& MyPersistentList<T, LeafCapacity, Branching>::const_iterator::operator--() noexcept {
+	CONTAINER_VERIFY(my_index > 0, "Can't decrement begin list iterator");
+	--my_index;
+	if (pos[depth] > 0)
+	{
+		--pos[depth];
+		return *this;
+	}
+	size_t level{ depth - 1 };
+	while (!pos[level])
+		--level;
+	--pos[level];
+	for (; level < depth; ++level)											//    
+	{
+		path[level + 1] = static_cast<const Inner*>(path[level])->children[pos[level]];
+		pos[level + 1] = path[level + 1]->count - 1;
+	}
+	return *this;
+}
+#endif	//MyPersistentList_H
@@ -0,0 +1,366 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#pragma once
+#ifndef MySmallLinkedList_H
+#define MySmallLinkedList_H
+#include "MyLinkedList.h"						//     
+#include <utility>								// std::forward
+#include <iterator>								// std::make_move_iterator
+#include <new>									//  new
+
+template <class T, size_t N = 4, template<class> class ListAllocator = MyListAllocator>
+class MySmallLinkedList {													// N     -     .
+	static_assert(N >= 1, "Inline capacity can't be less than 1 element");	//     MyLinkedList       
+public:
+	using List = MyLinkedList<T, ListAllocator>;
+	using value_type = T;
+	using size_type = size_t;
+	using difference_type = std::ptrdiff_t;
+	using reference = value_type&;
+	using const_reference = const value_type&;
+	using pointer = value_type*;
+	using const_pointer = const value_type*;
+	class iterator;
+	class const_iterator;
+	using reverse_iterator = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+	static constexpr size_t inline_capacity{ N };
+private:
+	static constexpr size_t promoted{ ~size_t{ 0 } };						// my_count    my_list
+	union {
+		List my_list;
+		alignas(T) unsigned char my_items[sizeof(T) * N];					// [0; my_count) ,  - 
+	};
+	size_t my_count;
+public:
+	inline MySmallLinkedList() noexcept : my_count{ 0 } {}
+	inline MySmallLinkedList(const std::initializer_list<T>& init) : MySmallLinkedList() { for (const T& val : init) emplace_back(val); }
+	MySmallLinkedList(const MySmallLinkedList& o);
+	inline MySmallLinkedList(MySmallLinkedList&& o) noexcept : my_count{ 0 } { move_helper(o); }
+	inline MySmallLinkedList& operator=(const MySmallLinkedList& o) { if (this != &o) { MySmallLinkedList copy{ o }; swap(copy); } return *this; }
+	inline MySmallLinkedList& operator=(MySmallLinkedList&& o) noexcept { if (this != &o) { reset_helper(); move_helper(o); } return *this; }
+	inline ~MySmallLinkedList() noexcept { reset_helper(); }
+public:
+	inline bool is_small() const noexcept { return my_count != promoted; }		//   
+	inline bool is_shared() const noexcept { return !is_small() && my_list.is_shared(); }
+	inline bool is_shared_with(const MySmallLinkedList& o) const noexcept { return !is_small() && !o.is_small() && my_list.is_shared_with(o.my_list); }
+	inline size_t size() const noexcept { return is_small() ? my_count : my_list.size(); }
+	inline bool empty() const noexcept { return size() == 0; }
+	inline bool isEmpty() const noexcept { return empty(); }
+	void promote();																//   MyLinkedList,    
+private:
+	inline T* items() noexcept { return reinterpret_cast<T*>(my_items); }
+	inline const T* items() const noexcept { return reinterpret_cast<const T*>(my_items); }
+
+	void reset_helper() noexcept;												//       
+	void move_helper(MySmallLinkedList& o) noexcept;							//     
+
+	template<class ...Types> void promote_helper(size_t pos, Types&&... Args);	//   :      pos
+public:
+	template<class ...Types> inline void emplace_back(Types&&... Args) { emplace(end(), std::forward<Types>(Args)...); }
+	template<class ...Types> inline void emplace_front(Types&&... Args) { emplace(begin(), std::forward<Types>(Args)...); }
+
+	inline void push_back(T&& val) { emplace_back(std::move(val)); }
+	inline void push_front(T&& val) { emplace_front(std::move(val)); }
+	inline void push_back(const T& val) { emplace_back(val); }
+	inline void push_front(const T& val) { emplace_front(val); }
+	inline void append(T&& val) { emplace_back(std::move(val)); }
+	inline void prepend(T&& val) { emplace_front(std::move(val)); }
+	inline void append(const T& val) { emplace_back(val); }
+	inline void prepend(const T& val) { emplace_front(val); }
+
+	inline void pop_back() noexcept { CONTAINER_VERIFY(!(empty()), "Empty list"); if (is_small()) items()[--my_count].~T(); else my_list.pop_back(); }
+	inline void pop_front() noexcept { CONTAINER_VERIFY(!(empty()), "Empty list"); erase(begin()); }
+	inline void removeFirst() noexcept { pop_front(); }
+	inline void removeLast() noexcept { pop_back(); }
+
+	template<class ...Types> iterator emplace(iterator before, Types&&... Args);	//   MyLinkedList    !
+	inline iterator insert(iterator before, T&& val) { return emplace(before, std::move(val)); }
+	inline iterator insert(iterator before, const T& val) { return emplace(before, val); }
+
+	iterator erase(iterator target) noexcept;
+public:
+	inline T& front() noexcept { CONTAINER_VERIFY(!(empty()), "Empty list"); return *begin(); }
+	inline T& first() noexcept { return front(); }
+	inline T& back() noexcept { CONTAINER_VERIFY(!(empty()), "Empty list"); return *(--end()); }
+	inline T& last() noexcept { return back(); }
+
+	inline const T& first() const noexcept { CONTAINER_VERIFY(!(empty()), "Empty list"); return *begin(); }
+	inline const T& front() const noexcept { return first(); }
+	inline const T& last() const noexcept { CONTAINER_VERIFY(!(empty()), "Empty list"); return *(--end()); }
+	inline const T& back() const noexcept { return last(); }
+public:
+	inline bool contains(const T& val) const noexcept { return find(val) != cend(); }
+	size_t count(const T& val) const noexcept;
+	inline const_iterator find(const T& val) const { const_iterator it{ cbegin() }; for (; it != cend() && *it != val; ++it); return it; }
+	inline const_iterator constFind(const T& val) const { return find(val); }
+	inline bool removeOne(const T& val)
+	{ const_iterator target{ find(val) }; if (target == cend()) return false; erase(iterator(target)); return true; }
+	template<class Predicate> size_t remove_if(Predicate pred);
+	inline size_t removeAll(const T& val) { return remove_if([&val](const T& node_val) { return node_val == val; }); }
+	inline size_t remove(const T& val) { return removeAll(val); }
+public:
+	inline void clear() noexcept { reset_helper(); }							//  :    
+	void swap(MySmallLinkedList& o) noexcept;
+public:
+	inline iterator begin() { return is_small() ? iterator(0, this) : iterator(my_list.begin(), this); }
+	inline reverse_iterator rbegin() { return std::make_reverse_iterator<iterator>(end()); }
+	inline const_iterator begin() const noexcept { return is_small() ? const_iterator(0, this) : const_iterator(my_list.begin(), this); }
+	inline const_iterator cbegin() const noexcept { return begin(); }
+	inline const_reverse_iterator rbegin() const noexcept { return std::make_reverse_iterator<const_iterator>(end()); }
+	inline const_reverse_iterator crbegin() const noexcept { return std::make_reverse_iterator<const_iterator>(cend()); }
+	inline const_iterator constBegin() const noexcept { return begin(); }
+
+	inline iterator end() { return is_small() ? iterator(my_count, this) : iterator(my_list.end(), this); }
+	inline reverse_iterator rend() { return std::make_reverse_iterator<iterator>(begin()); }
+	inline const_iterator end() const noexcept { return is_small() ? const_iterator(my_count, this) : const_iterator(my_list.end(), this); }
+	inline const_iterator cend() const noexcept { return end(); }
+	inline const_reverse_iterator rend() const noexcept { return std::make_reverse_iterator<const_iterator>(begin()); }
+	inline const_reverse_iterator crend() const noexcept { return std::make_reverse_iterator<const_iterator>(cbegin()); }
+	inline const_iterator constEnd() const noexcept { return end(); }
+
+	inline const MySmallLinkedList& as_const() const noexcept { return *this; }
+public:
+	inline MySmallLinkedList& operator+=(const T& val) { emplace_back(val); return *this; }
+	inline MySmallLinkedList& operator+=(T&& val) { emplace_back(std::move(val)); return *this; }
+	inline MySmallLinkedList& operator<<(const T& val) { emplace_back(val); return *this; }
+	inline MySmallLinkedList& operator<<(T&& val) { emplace_back(std::move(val)); return *this; }
+	bool operator==(const MySmallLinkedList& o) const;
+	inline bool operator!=(const MySmallLinkedList& o) const { return !(*this == o); }
+public:
+	class iterator {
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = MySmallLinkedList::value_type;
+		using difference_type = ptrdiff_t;
+		using pointer = MySmallLinkedList::pointer;
+		using reference = MySmallLinkedList::reference;
+	private:
+		friend class MySmallLinkedList;
+		typename List::iterator my_it;										//   
+		size_t my_pos;														//   
+		MySmallLinkedList* my_cont;
+	public:
+		inline iterator() noexcept : my_it{}, my_pos{ 0 }, my_cont{ nullptr } {}
+		inline iterator(size_t pos, MySmallLinkedList* cont) noexcept : my_it{}, my_pos{ pos }, my_cont{ cont } {}
+		inline iterator(typename List::iterator it, MySmallLinkedList* cont) noexcept : my_it{ it }, my_pos{ 0 }, my_cont{ cont } {}
+		inline explicit iterator(const const_iterator& o) noexcept;			//     
+		inline iterator(const iterator& o) noexcept = default;
+		inline iterator& operator=(const iterator&) noexcept = default;
+		inline ~iterator() noexcept = default;
+	public:
+		inline iterator& operator++() noexcept
+		{ if (my_cont->is_small()) { CONTAINER_VERIFY(my_pos < my_cont->my_count, "Can't increment end list iterator"); ++my_pos; } else ++my_it; return *this; }
+		inline iterator& operator--() noexcept
+		{ if (my_cont->is_small()) { CONTAINER_VERIFY(my_pos > 0, "Can't decrement begin list iterator"); --my_pos; } else --my_it; return *this; }
+		inline iterator operator++(int) noexcept { iterator temp{ *this }; ++(*this); return temp; }
+		inline iterator operator--(int) noexcept { iterator temp{ *this }; --(*this); return temp; }
+		inline bool operator==(const iterator& o) const noexcept { return my_pos == o.my_pos && my_it == o.my_it; }
+		inline bool operator!=(const iterator& o) const noexcept { return !(*this == o); }
+		inline T& operator*() const noexcept
+		{ if (my_cont->is_small()) { CONTAINER_VERIFY(my_pos < my_cont->my_count, "Can't dereference end iterator"); return my_cont->items()[my_pos]; } return *my_it; }
+		inline T* operator->() const noexcept { return std::addressof(**this); }
+	};
+
+	class const_iterator {
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = MySmallLinkedList::value_type;
+		using difference_type = ptrdiff_t;
+		using pointer = MySmallLinkedList::const_pointer;
+		using reference = MySmallLinkedList::const_reference;
+	private:
+		friend class MySmallLinkedList;
+		friend class iterator;
+		typename List::const_iterator my_it;
+		size_t my_pos;
+		const MySmallLinkedList* my_cont;
+	public:
+		inline const_iterator() noexcept : my_it{}, my_pos{ 0 }, my_cont{ nullptr } {}
+		inline const_iterator(size_t pos, const MySmallLinkedList* cont) noexcept : my_it{}, my_pos{ pos }, my_cont{ cont } {}
+		inline const_iterator(typename List::const_iterator it, const MySmallLinkedList* cont) noexcept : my_it{ it }, my_pos{ 0 }, my_cont{ cont } {}
+		inline const_iterator(const const_iterator& o) noexcept = default;
+		inline const_iterator& operator=(const const_iterator&) noexcept = default;
+		inline ~const_iterator() noexcept = default;
+	public:
+		inline const_iterator& operator++() noexcept
+		{ if (my_cont->is_small()) { CONTAINER_VERIFY(my_pos < my_cont->my_count, "Can't increment end list iterator"); ++my_pos; } else ++my_it; return *this; }
+		inline const_iterator& operator--() noexcept
+		{ if (my_cont->is_small()) { CONTAINER_VERIFY(my_pos > 0, "Can't decrement begin list iterator"); --my_pos; } else --my_it; return *this; }
+		inline const_iterator operator++(int) noexcept { const_iterator temp{ *this }; ++(*this); return temp; }
+		inline const_iterator operator--(int) noexcept { const_iterator temp{ *this }; --(*this); return temp; }
+		inline bool operator==(const const_iterator& o) const noexcept { return my_pos == o.my_pos && my_it == o.my_it; }
+		inline bool operator!=(const const_iterator& o) const noexcept { return !(*this == o); }
+	public:
+		inline const T& operator*() const noexcept
+		{ if (my_cont->is_small()) { CONTAINER_VERIFY(my_pos < my_cont->my_count, "Can't dereference end iterator"); return my_cont->items()[my_pos]; } return *my_it; }
+		inline const T* operator->() const noexcept { return std::addressof(**this); }
+	};
+};
+
+template <class T, size_t N, template<class> class ListAllocator>
+inline MySmallLinkedList<T, N, ListAllocator>::iterator::iterator(const const_iterator& o) noexcept
+	: my_it{}, my_pos{ o.my_pos }, my_cont{ const_cast<MySmallLinkedList*>(o.my_cont) } {
+	if (!my_cont->is_small())												//    -      
+	{
+		size_t offset{ 0 };
+		for (typename List::const_iterator it = my_cont->my_list.cbegin(); it != o.my_it; ++it)
+			++offset;
+		my_it = my_cont->my_list.begin();
+		for (; offset > 0; --offset)
+			++my_it;
+	}
+}
+
+template <class T, size_t N, template<class> class ListAllocator>
+MySmallLinkedList<T, N, ListAllocator>::MySmallLinkedList(const MySmallLinkedList& o) : my_count{ 0 } {
+	if (o.is_small())														//   -    
+		for (; my_count < o.my_count; ++my_count)
+			new (items() + my_count) T(o.items()[my_count]);
+	else
+	{
+		new (&my_list) List(o.my_list);										//     
+		my_count = promoted;
+	}
+}
+
+template <class T, size_t N, template<class> class ListAllocator>
+void MySmallLinkedList<T, N, ListAllocator>::move_helper(MySmallLinkedList& o) noexcept {
+	if (o.is_small())
+		for (; my_count < o.my_count; ++my_count)
+			new (items() + my_count) T(std::move(o.items()[my_count]));
+	else
+	{
+		new (&my_list) List(std::move(o.my_list));
+		my_count = promoted;
+	}
+	o.reset_helper();
+}
+
+template <class T, size_t N, template<class> class ListAllocator>
+void MySmallLinkedList<T, N, ListAllocator>::reset_helper() noexcept {
+	if (is_small())
+		for (; my_count > 0; --my_count)
+			items()[my_count - 1].~T();
+	else
+	{
+		my_list.~List();
+		my_count = 0;
+	}
+}
+
+template <class T, size_t N, template<class> class ListAllocator>
+void MySmallLinkedList<T, N, ListAllocator>::promote() {
+	if (!is_small())
+		return;
+	List moved;
+	moved.insert(moved.end(), std::make_move_iterator(items()), std::make_move_iterator(items() + my_count));	//      
+	reset_helper();
+	new (&my_list) List(std::move(moved));
+	my_count = promoted;
+}
+
+template <class T, size_t N, template<class> class ListAllocator>
+template<class ...Types>
+void MySmallLinkedList<T, N, ListAllocator>::promote_helper(size_t pos, Types&&... Args) {
+	List moved;
+	moved.emplace_back(std::forward<Types>(Args)...);						//  :      
+	moved.insert(moved.begin(), std::make_move_iterator(items()), std::make_move_iterator(items() + pos));
+	moved.insert(moved.end(), std::make_move_iterator(items() + pos), std::make_move_iterator(items() + my_count));
+	reset_helper();
+	new (&my_list) List(std::move(moved));
+	my_count = promoted;
+}
+
+template <class T, size_t N, template<class> class ListAllocator>
+template<class ...Types>
+typename MySmallLinkedList<T, N, ListAllocator>::iterator MySmallLinkedList<T, N, ListAllocator>::emplace(iterator before, Types&&... Args) {
+	CONTAINER_VERIFY(before.my_cont == this, "Can't insert into another container");
+	if (!is_small())
+		return iterator(my_list.emplace(before.my_it, std::forward<Types>(Args)...), this);
+	size_t pos{ before.my_pos };
+	if (my_count == N)
+	{
+		promote_helper(pos, std::forward<Types>(Args)...);
+		iterator it{ my_list.begin(), this };
+		for (; pos > 0; --pos)
+			++it;
+		return it;
+	}
+	if (pos == my_count)
+		new (items() + my_count) T(std::forward<Types>(Args)...);
+	else																	//     
+	{
+		T val(std::forward<Types>(Args)...);
+		new (items() + my_count) T(std::move(items()[my_count - 1]));
+		for (size_t i = my_count - 1; i > pos; --i)
+			items()[i] = std::move(items()[i - 1]);
+		items()[pos] = std::move(val);
+	}
+	++my_count;
+	return iterator(pos, this);
+}
+
+template <class T, size_t N, template<class> class ListAllocator>
+typename MySmallLinkedList<T, N, ListAllocator>::iterator MySmallLinkedList<T, N, ListAllocator>::erase(iterator target) noexcept {
+	CONTAINER_VERIFY(target.my_cont == this, "Can't erase from another container");
+	if (!is_small())
+		return iterator(my_list.erase(target.my_it), this);
+	CONTAINER_VERIFY(target.my_pos < my_count, "Can't delete end element");
+	for (size_t i = target.my_pos; i + 1 < my_count; ++i)
+		items()[i] = std::move(items()[i + 1]);
+	items()[--my_count].~T();
+	return target;
+}
+
+template <class T, size_t N, template<class> class ListAllocator>
+size_t MySmallLinkedList<T, N, ListAllocator>::count(const T& val) const noexcept {
+	size_t count{ 0 };
+	for (const_iterator it = cbegin(); it != cend(); ++it)
+		if (*it == val)
+			++count;
+	return count;
+}
+
+template <class T, size_t N, template<class> class ListAllocator>
+template<class Predicate>
+size_t MySmallLinkedList<T, N, ListAllocator>::remove_if(Predicate pred) {
+	if (!is_small())
+		return my_list.remove_if(pred);
+	size_t kept{ 0 };
+	for (size_t i = 0; i < my_count; ++i)
+		if (!pred(items()[i]))
+		{
+			if (kept != i)
+				items()[kept] = std::move(items()[i]);
+			++kept;
+		}
+	size_t removed{ my_count - kept };
+	for (; my_count > kept; --my_count)
+		items()[my_count - 1].~T();
+	return removed;
+}
+
+template <class T, size_t N, template<class> class ListAllocator>
+void MySmallLinkedList<T, N, ListAllocator>::swap(MySmallLinkedList& o) noexcept {
+	if (this != &o)
+	{
+		MySmallLinkedList temp{ std::move(o) };
+		o = std::move(*this);
+		*this = std::move(temp);
+	}
+}
+
+template <class T, size_t N, template<class> class ListAllocator>
+bool MySmallLinkedList<T, N, ListAllocator>::operator==(const MySmallLinkedList& o) const {
+	if (size() != o.size())
+		return false;
+	if (is_shared_with(o))
+		return true;
+	for (const_iterator it = cbegin(), o_it = o.cbegin(); it != cend(); ++it, ++o_it)
+		if (*it != *o_it)
+			return false;
+	return true;
+}
+#endif	//MySmallLinkedList_H
@@ -0,0 +1,709 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#pragma once
+#ifndef MyUnrolledList_H
+#define MyUnrolledList_H
+#ifndef PRED_TO_BOOL
+#define PRED_TO_BOOL(pred, x, y) static_cast<bool>(pred(x, y))
+#endif
+#include "MyListAllocator.h"					// 
+#ifdef _MSC_VER
+#include <xstddef>								//  
+#endif
+#include <utility>								// std::forward
+#include <memory>								//   
+#include <vector>								//   
+#include <algorithm>							// std::stable_sort  std::none_of
+#ifndef CONTAINER_VERIFY
+#ifdef _STL_VERIFY
+#define CONTAINER_VERIFY(cond, what) _STL_VERIFY(cond, what)
+#else
+#include <cassert>
+#define CONTAINER_VERIFY(cond, what) assert((cond) && what)
+#endif
+#endif
+
+template <class T>
+struct MyUnrolledListCapacity {												//   :  256  ,    8    32 
+	static constexpr size_t value{ 256 / sizeof(T) < 8 ? 8 : (256 / sizeof(T) > 32 ? 32 : 256 / sizeof(T)) };
+};
+
+template <class T, size_t NodeCapacity = MyUnrolledListCapacity<T>::value>
+class MyUnrolledList {														// :      NodeCapacity 
+	static_assert(NodeCapacity >= 2, "Node capacity can't be less than 2 elements");
+public:
+	using value_type = T;
+	using size_type = size_t;
+	using difference_type = std::ptrdiff_t;
+	using reference = value_type&;
+	using const_reference = const value_type&;
+	using pointer = value_type*;
+	using const_pointer = const value_type*;
+	class iterator;
+	class const_iterator;
+	using reverse_iterator = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+	static constexpr size_t node_capacity{ NodeCapacity };
+private:
+	struct BaseNode;
+	struct Node;
+	using Allocator = MyListAllocator<Node>;
+	using SharedAllocator = std::shared_ptr<Allocator>;
+private:
+	SharedAllocator alc;
+	Node* my_end;							//|my_end(no data)|<---|(data x N)|<--->...<--->|(data x N)|--->|my_end(no data)|
+	size_t my_size;
+public:
+	inline MyUnrolledList() : alc{ nullptr }, my_end{ nullptr }, my_size{ 0 } {}
+	explicit MyUnrolledList(size_t count);
+	inline MyUnrolledList(const std::initializer_list<T>& init) : MyUnrolledList() { detach_helper(); copy_helper(init.begin(), init.end()); }
+	inline MyUnrolledList(const MyUnrolledList& o) noexcept : alc{ o.alc }, my_end{ o.my_end }, my_size{ o.my_size } {}
+	inline MyUnrolledList(MyUnrolledList&& o) noexcept : MyUnrolledList() { move_list(std::move(o)); }
+	MyUnrolledList& operator=(const MyUnrolledList& o);
+	MyUnrolledList& operator=(MyUnrolledList&& o) noexcept;
+	inline ~MyUnrolledList() noexcept { if (!is_shared()) clear(); }
+public:
+	inline bool is_shared() const noexcept { return alc.use_count() != 1; }
+	inline bool is_shared_with(const MyUnrolledList& o) const noexcept { return alc == o.alc; }
+	inline size_t shared_data_use_count() const noexcept { return alc.use_count(); }
+	inline MyListAllocatorStatistics allocator_statistics() const noexcept { return alc ? alc->statistics() : MyListAllocatorStatistics{}; }
+	inline size_t size() const noexcept { return my_size; }
+	inline bool empty() const noexcept { return my_size == 0; }
+	inline bool isEmpty() const noexcept { return my_size == 0; }
+private:
+	void detach_helper(Node** first_target = nullptr, Node** second_target = nullptr);
+
+	inline Node* create_node(Node* prev, Node* next)						//       prev  next
+	{ Node* new_node{ new(alc->allocate()) Node() }; new_node->p = prev; new_node->n = next; prev->n = new_node; next->p = new_node; return new_node; }
+
+	inline Node* create_base_node()
+	{ Node* new_node{ reinterpret_cast<Node*>(new (alc->allocate()) BaseNode()) }; new_node->n = new_node; new_node->p = new_node; return new_node; }
+
+	inline void destroy_node(Node* target) noexcept							//         
+	{ target->p->n = target->n; target->n->p = target->p; target->~Node(); alc->deallocate(target); }
+
+	static inline void relocate(T* dst, T* src)								//       
+	{ new (dst) T(std::move_if_noexcept(*src)); src->~T(); }
+
+	std::pair<Node*, size_t> make_slot(Node* node, size_t pos);				//    pos,    
+	iterator normalize(Node* node, size_t pos) noexcept;					//       
+
+	template<class Predicate> size_t remove_helper(Predicate pred);
+
+	void move_list(MyUnrolledList&&) noexcept;
+
+	template <class InputIt>
+	void copy_helper(InputIt first, InputIt last);							//  [first; last)       
+public:
+	template<class ...Types> void emplace_back(Types&&... Args);
+	template<class ...Types> inline void emplace_front(Types&&... Args) { emplace(begin(), std::forward<Types>(Args)...); }
+
+	inline void push_back(T&& val) { emplace_back(std::move(val)); }
+	inline void push_front(T&& val) { emplace_front(std::move(val)); }
+	inline void push_back(const T& val) { emplace_back(val); }
+	inline void push_front(const T& val) { emplace_front(val); }
+	inline void append(T&& val) { emplace_back(std::move(val)); }
+	inline void prepend(T&& val) { emplace_front(std::move(val)); }
+	inline void append(const T& val) { emplace_back(val); }
+	inline void prepend(const T& val) { emplace_front(val); }
+
+	inline void pop_back() noexcept { CONTAINER_VERIFY(!(empty()), "Empty list"); erase(--end()); }
+	inline void pop_front() noexcept { CONTAINER_VERIFY(!(empty()), "Empty list"); erase(begin()); }
+	inline void removeFirst() noexcept { pop_front(); }
+	inline void removeLast() noexcept { pop_back(); }
+
+	template<class ...Types> iterator emplace(iterator before, Types&&... Args);	//      !
+	inline iterator insert(iterator before, T&& val) { return emplace(before, std::move(val)); }
+	inline iterator insert(iterator before, const T& val) { return emplace(before, val); }
+	template<class InputIt> iterator insert(iterator before, InputIt first, InputIt last);
+
+	iterator erase(iterator) noexcept;
+	iterator erase(iterator first, iterator last) noexcept;
+public:
+	inline T& front() noexcept { CONTAINER_VERIFY(!(empty()), "Empty list"); return *begin(); }
+	inline T& first() noexcept { return front(); }
+	inline T& back() noexcept { CONTAINER_VERIFY(!(empty()), "Empty list"); return *(--end()); }
+	inline T& last() noexcept { return back(); }
+
+	inline const T& first() const noexcept { CONTAINER_VERIFY(!(empty()), "Empty list"); return *begin(); }
+	inline const T& front() const noexcept { return first(); }
+	inline const T& last() const noexcept { CONTAINER_VERIFY(!(empty()), "Empty list"); return *(--end()); }
+	inline const T& back() const noexcept { return last(); }
+
+	inline T takeFirst() noexcept
+	{ CONTAINER_VERIFY(!(empty()), "Empty list"); if (is_shared()) detach_helper(); T val{ std::move_if_noexcept(my_end->n->data()[0]) }; pop_front(); return val; }
+	inline T takeLast() noexcept
+	{ CONTAINER_VERIFY(!(empty()), "Empty list"); if (is_shared()) detach_helper(); T val{ std::move_if_noexcept(my_end->p->data()[my_end->p->count - 1]) }; pop_back(); return val; }
+public:
+	bool contains(const T&) const noexcept;
+	size_t count(const T& val) const noexcept;
+	inline bool startsWith(const T& val) const noexcept { if (!empty()) return first() == val; return false; }
+	inline bool endsWith(const T& val) const noexcept { if (!empty()) return last() == val; return false; }
+	inline bool removeOne(const T& val) noexcept												//   :   ,    
+	{ const_iterator target{ find(val, cbegin()) }; if (target != cend()) { erase(iterator(target.my_node, target.my_pos, this)); return true; } return false; }
+	inline size_t remove(const T& val) noexcept { return removeAll(val); }
+	template<class Predicate> inline size_t remove_if(Predicate pred) { return remove_helper(pred); }
+	size_t removeAll(const T& val) noexcept { return remove_helper([&val](auto&& node_val) {return node_val == val; }); }
+public:
+	inline iterator find(const T& val) { return find(val, begin()); }
+	inline iterator find(const T& val, iterator it) { for (; it != end() && *it != val; ++it); return it; }
+	inline const_iterator find(const T& val) const { return find(val, cbegin()); }
+	inline const_iterator find(const T& val, const_iterator it) const { for (; it != cend() && *it != val; ++it); return it; }
+	inline const_iterator constFind(const T& val) const { return find(val); }
+
+	inline iterator findFromEnd(const T& val) { return findFromEnd(val, end()); }
+	inline iterator findFromEnd(const T& val, iterator it) { if (!empty()) do { if (*(--it) == val) return it; } while (it != begin()); return end(); }
+public:
+	void clear() noexcept;
+	inline void reserve(size_t size) { if (is_shared()) detach_helper(); if (size > my_size) alc->reserve((size - my_size) / NodeCapacity + 1); }
+
+	inline void swap(MyUnrolledList& o) noexcept { std::swap(alc, o.alc); std::swap(my_end, o.my_end); std::swap(my_size, o.my_size); }
+
+	inline void sort() { sort(std::less<>()); }
+	template<class Predicate> inline void sort(Predicate comparator) { sort(begin(), end(), comparator); }
+	inline void sort(iterator begin, iterator end) { sort(begin, end, std::less<>()); }
+	template<class Predicate> void sort(iterator begin, iterator end, Predicate comparator);	//         .     
+public:
+	inline iterator begin() { if (is_shared()) detach_helper(); return iterator(my_end->n, 0, this); }
+	inline reverse_iterator rbegin() noexcept { return std::make_reverse_iterator<iterator>(end()); }
+	inline const_iterator begin() const noexcept { return const_iterator(my_end ? my_end->n : my_end, 0, this); }
+	inline const_iterator cbegin() const noexcept { return begin(); }
+	inline const_reverse_iterator rbegin() const noexcept { return std::make_reverse_iterator<const_iterator>(end()); }
+	inline const_reverse_iterator crbegin() const noexcept { return std::make_reverse_iterator<const_iterator>(cend()); }
+	inline const_iterator constBegin() const noexcept { return begin(); }
+
+	inline iterator end() { if (is_shared()) detach_helper(); return iterator(my_end, 0, this); }
+	inline reverse_iterator rend() noexcept { return std::make_reverse_iterator<iterator>(begin()); }
+	inline const_iterator end() const noexcept { return const_iterator(my_end, 0, this); }
+	inline const_iterator cend() const noexcept { return end(); }
+	inline const_reverse_iterator rend() const noexcept { return std::make_reverse_iterator<const_iterator>(begin()); }
+	inline const_reverse_iterator crend() const noexcept { return std::make_reverse_iterator<const_iterator>(cbegin()); }
+	inline const_iterator constEnd() const noexcept { return end(); }
+
+	inline const MyUnrolledList& as_const() const noexcept { return *this; }	//    : for (const T& val : list.as_const())
+public:
+	inline MyUnrolledList& operator+=(const T& val) { emplace_back(val); return *this; }
+	inline MyUnrolledList& operator+=(T&& val) { emplace_back(std::move(val)); return *this; }
+	inline MyUnrolledList& operator<<(const T& val) { emplace_back(val); return *this; }
+	inline MyUnrolledList& operator<<(T&& val) { emplace_back(std::move(val)); return *this; }
+	MyUnrolledList& operator+=(const MyUnrolledList&);
+	inline MyUnrolledList operator+(const MyUnrolledList& o) { MyUnrolledList result{ *this }; result += o; return result; }
+	bool operator==(const MyUnrolledList& o) const;
+	inline bool operator!=(const MyUnrolledList& o) const { return !(*this == o); }
+public:
+	class iterator {
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = MyUnrolledList::value_type;
+		using difference_type = ptrdiff_t;
+		using pointer = MyUnrolledList::pointer;
+		using reference = MyUnrolledList::reference;
+	private:
+		friend class MyUnrolledList;
+		friend class const_iterator;
+		Node* my_node;
+		size_t my_pos;														//   
+		MyUnrolledList* my_cont;
+	public:
+		inline iterator() noexcept : my_node{ nullptr }, my_pos{ 0 }, my_cont{ nullptr } {}
+		inline iterator(Node* node, size_t pos, MyUnrolledList* cont) noexcept : my_node{ node }, my_pos{ pos }, my_cont{ cont } {}
+		inline iterator(const iterator& o) noexcept = default;
+		inline iterator& operator=(const iterator&) noexcept = default;
+		inline ~iterator() noexcept = default;
+	public:
+		inline iterator& operator++() noexcept
+		{ CONTAINER_VERIFY(my_node != my_cont->my_end, "Can't increment end list iterator"); if (++my_pos == my_node->count) { my_node = my_node->n; my_pos = 0; } return *this; }
+		inline iterator& operator--() noexcept
+		{ if (my_pos) --my_pos; else { my_node = my_node->p; CONTAINER_VERIFY(my_node != my_cont->my_end, "Can't decrement begin list iterator"); my_pos = my_node->count - 1; } return *this; }
+		inline iterator operator++(int) noexcept { iterator temp{ *this }; ++(*this); return temp; }
+		inline iterator operator--(int) noexcept { iterator temp{ *this }; --(*this); return temp; }
+		iterator& operator+=(int offset) noexcept;							//    
+		inline iterator& operator-=(int offset) noexcept { return *this += (-offset); }
+		inline iterator operator+(int offset) noexcept { iterator it{ *this }; return it += offset; }
+		inline iterator operator-(int offset) noexcept { iterator it{ *this }; return it += (-offset); }
+		inline friend iterator operator+(int offset, iterator it) noexcept { return it + offset; }
+		inline bool operator==(const iterator& o) const noexcept { return my_node == o.my_node && my_pos == o.my_pos; }
+		inline bool operator!=(const iterator& o) const noexcept { return !(*this == o); }
+		inline T& operator*() const noexcept { CONTAINER_VERIFY(my_node != my_cont->my_end, "Can't dereference end iterator"); return my_node->data()[my_pos]; }
+		inline T* operator->() const noexcept
+		{ CONTAINER_VERIFY(my_node != my_cont->my_end, "Can't dereference end list iterator"); return my_node->data() + my_pos; }
+	};
+
+	class const_iterator {
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = MyUnrolledList::value_type;
+		using difference_type = ptrdiff_t;
+		using pointer = MyUnrolledList::const_pointer;
+		using reference = MyUnrolledList::const_reference;
+	private:
+		friend class MyUnrolledList;
+		Node* my_node;
+		size_t my_pos;
+		const MyUnrolledList* my_cont;
+	public:
+		inline const_iterator() noexcept : my_node{ nullptr }, my_pos{ 0 }, my_cont{ nullptr } {}
+		inline const_iterator(Node* node, size_t pos, const MyUnrolledList* cont) noexcept : my_node{ node }, my_pos{ pos }, my_cont{ cont } {}
+		inline const_iterator(const iterator& o) noexcept : my_node{ o.my_node }, my_pos{ o.my_pos }, my_cont{ o.my_cont } {}
+		inline const_iterator(const const_iterator& o) noexcept = default;
+		inline const_iterator& operator=(const const_iterator&) noexcept = default;
+		inline ~const_iterator() noexcept = default;
+	public:
+		inline const_iterator& operator++() noexcept
+		{ CONTAINER_VERIFY(my_node != my_cont->my_end, "Can't increment end list iterator"); if (++my_pos == my_node->count) { my_node = my_node->n; my_pos = 0; } return *this; }
+		inline const_iterator& operator--() noexcept
+		{ if (my_pos) --my_pos; else { my_node = my_node->p; CONTAINER_VERIFY(my_node != my_cont->my_end, "Can't decrement begin list iterator"); my_pos = my_node->count - 1; } return *this; }
+		inline const_iterator operator++(int) noexcept { const_iterator temp{ *this }; ++(*this); return temp; }
+		inline const_iterator operator--(int) noexcept { const_iterator temp{ *this }; --(*this); return temp; }
+		inline bool operator==(const const_iterator& o) const noexcept { return my_node == o.my_node && my_pos == o.my_pos; }
+		inline bool operator!=(const const_iterator& o) const noexcept { return !(*this == o); }
+	public:
+		inline const T& operator*() const noexcept { CONTAINER_VERIFY(my_node != my_cont->my_end, "Can't dereference end iterator"); return my_node->data()[my_pos]; }
+		inline const T* operator->() const noexcept
+		{ CONTAINER_VERIFY(my_node != my_cont->my_end, "Can't dereference end list iterator"); return my_node->data() + my_pos; }
+	};
+private:
+	struct BaseNode {														//  .  my_end   
+		Node* p, * n;
+		size_t count;														//   
+		inline BaseNode(Node* prev = nullptr, Node* next = nullptr) : p{ prev }, n{ next }, count{ 0 } {}
+		inline BaseNode(const BaseNode&) = delete;
+		inline BaseNode& operator=(const BaseNode&) = delete;
+		inline ~BaseNode() = default;
+	};
+	struct Node : public BaseNode {											// [0; count) ,  - 
+		alignas(T) unsigned char storage[sizeof(T) * NodeCapacity];
+		inline Node() : BaseNode() {}
+		inline T* data() noexcept { return reinterpret_cast<T*>(storage); }
+		inline Node(const Node&) = delete;
+		inline Node& operator=(const Node&) = delete;
+		inline ~Node() = default;
+	};
+};
+
+template <class T, size_t NodeCapacity>
+MyUnrolledList<T, NodeCapacity>::MyUnrolledList(size_t count)
+	: MyUnrolledList() {
+	detach_helper();
+	alc->reserve(count / NodeCapacity + 1);
+	for (size_t i = 0; i < count; ++i)
+		emplace_back();
+}
+
+template <class T, size_t NodeCapacity>
+void MyUnrolledList<T, NodeCapacity>::detach_helper(Node** first_target, Node** second_target) {
+	MYLIST_STAT(if (alc) MyListStatistics::detached(my_size);)				//     -  
+	SharedAllocator old_alc{ alc };											//   ,      
+	Node* old_end{ my_end };
+	size_t nodes_count{ 0 };
+	if (old_end)
+		for (Node* cur = old_end->n; cur != old_end; cur = cur->n)
+			++nodes_count;
+	std::pair<Node*, Node*> targets{ first_target ? *first_target : nullptr, second_target ? *second_target : nullptr };
+	alc = std::make_shared<Allocator>();
+	Node* new_end{ nullptr };
+	try
+	{
+		alc->reserve(nodes_count + 1);
+		new_end = create_base_node();
+		if (old_end)
+			for (Node* cur = old_end->n; cur != old_end; cur = cur->n)		//    ,    
+			{
+				Node* copy{ create_node(new_end->p, new_end) };
+				for (T* val = cur->data(); copy->count < cur->count; ++val, ++copy->count)
+					new (copy->data() + copy->count) T(*val);
+				if (targets.first == cur)
+					targets.first = copy;
+				if (targets.second == cur)
+					targets.second = copy;
+			}
+	}
+	catch (...)																//    ,     
+	{
+		if (new_end)
+			for (Node* cur = new_end->n; cur != new_end; cur = cur->n)
+				for (size_t i = 0; i < cur->count; ++i)
+					cur->data()[i].~T();
+		alc = std::move(old_alc);
+		throw;
+	}
+	if (old_end)
+	{
+		if (targets.first == old_end)
+			targets.first = new_end;
+		if (targets.second == old_end)
+			targets.second = new_end;
+	}
+	my_end = new_end;
+	if (first_target)
+		*first_target = targets.first;
+	if (second_target)
+		*second_target = targets.second;
+}
+
+template <class T, size_t NodeCapacity>
+template <class InputIt>
+void MyUnrolledList<T, NodeCapacity>::copy_helper(InputIt first, InputIt last) {
+	for (; first != last; ++first)
+	{
+		Node* tail{ my_end->p };
+		if (tail == my_end || tail->count == NodeCapacity)
+			tail = create_node(my_end->p, my_end);
+		new (tail->data() + tail->count) T(*first);
+		++tail->count;
+		++my_size;
+	}
+}
+
+template <class T, size_t NodeCapacity>
+void MyUnrolledList<T, NodeCapacity>::move_list(MyUnrolledList&& o) noexcept {
+	if (!o.empty())
+	{
+		std::swap(my_end, o.my_end);
+		my_size = o.my_size;
+		o.my_size = 0;
+		std::swap(alc, o.alc);
+	}
+}
+
+template <class T, size_t NodeCapacity>
+MyUnrolledList<T, NodeCapacity>& MyUnrolledList<T, NodeCapacity>::operator=(const MyUnrolledList& o) {
+	if (alc != o.alc)
+	{
+		if (!is_shared())
+			clear();
+		alc = o.alc;
+		my_end = o.my_end;
+		my_size = o.my_size;
+	}
+	return *this;
+}
+
+template <class T, size_t NodeCapacity>
+MyUnrolledList<T, NodeCapacity>& MyUnrolledList<T, NodeCapacity>::operator=(MyUnrolledList&& o) noexcept {
+	if (alc != o.alc)
+	{
+		if (!is_shared())
+			clear();
+		alc = nullptr;
+		my_end = nullptr;
+		my_size = 0;
+		move_list(std::move(o));
+	}
+	return *this;
+}
+
+template <class T, size_t NodeCapacity>
+void MyUnrolledList<T, NodeCapacity>::clear() noexcept {
+	if (is_shared())														//    -     
+	{
+		alc.reset();
+		my_end = nullptr;
+		my_size = 0;
+	}
+	else if (!empty())
+	{
+		for (Node* cur = my_end->n; cur != my_end; cur = cur->n)
+			for (size_t i = 0; i < cur->count; ++i)
+				cur->data()[i].~T();
+		alc->clear();														//     -   
+		my_end->p = my_end;
+		my_end->n = my_end;
+		my_size = 0;
+	}
+}
+
+template <class T, size_t NodeCapacity>
+std::pair<typename MyUnrolledList<T, NodeCapacity>::Node*, size_t> MyUnrolledList<T, NodeCapacity>::make_slot(Node* node, size_t pos) {
+	if (node == my_end)														//  :       
+	{
+		node = my_end->p;
+		if (node == my_end || node->count == NodeCapacity)
+			node = create_node(my_end->p, my_end);
+		return { node, node->count };
+	}
+	if (node->count == NodeCapacity)
+	{
+		if (!pos)
+		{
+			if (node->p != my_end && node->p->count < NodeCapacity)		//      
+				return { node->p, node->p->count };
+			return { create_node(node->p, node), 0 };						//     -    
+		}
+		Node* new_node{ create_node(node, node->n) };						//  
+		constexpr size_t half{ NodeCapacity / 2 };
+		for (size_t i = half; i < NodeCapacity; ++i)
+			relocate(new_node->data() + i - half, node->data() + i);
+		new_node->count = NodeCapacity - half;
+		node->count = half;
+		if (pos > half)
+		{
+			node = new_node;
+			pos -= half;
+		}
+	}
+	T* cells{ node->data() };
+	for (size_t i = node->count; i > pos; --i)
+		relocate(cells + i, cells + i - 1);
+	return { node, pos };
+}
+
+template <class T, size_t NodeCapacity>
+template<class ...Types>
+void MyUnrolledList<T, NodeCapacity>::emplace_back(Types&&... Args) {
+	if (is_shared())
+		detach_helper();
+	Node* tail{ my_end->p };
+	if (tail == my_end || tail->count == NodeCapacity)
+		tail = create_node(my_end->p, my_end);
+	new (tail->data() + tail->count) T(std::forward<Types>(Args)...);
+	++tail->count;
+	++my_size;
+}
+
+template <class T, size_t NodeCapacity>
+template<class ...Types>
+typename MyUnrolledList<T, NodeCapacity>::iterator MyUnrolledList<T, NodeCapacity>::emplace(iterator before, Types&&... Args) {
+	CONTAINER_VERIFY(before.my_cont == this, "Can't insert into another container");
+	if (is_shared())
+		detach_helper(std::addressof(before.my_node));
+	std::pair<Node*, size_t> slot;
+	if (before.my_node == my_end)
+	{
+		slot = make_slot(my_end, 0);
+		new (slot.first->data() + slot.second) T(std::forward<Types>(Args)...);
+	}
+	else
+	{																		//      -   
+		T val(std::forward<Types>(Args)...);
+		slot = make_slot(before.my_node, before.my_pos);
+		new (slot.first->data() + slot.second) T(std::move(val));
+	}
+	++slot.first->count;
+	++my_size;
+	return iterator(slot.first, slot.second, this);
+}
+
+template <class T, size_t NodeCapacity>
+template<class InputIt>
+typename MyUnrolledList<T, NodeCapacity>::iterator MyUnrolledList<T, NodeCapacity>::insert(iterator before, InputIt first, InputIt last) {
+	CONTAINER_VERIFY(before.my_cont == this, "Can't insert into another container");
+	if (first == last)
+		return before;
+	iterator it{ emplace(before, *first) };
+	size_t inserted{ 1 };
+	for (++first; first != last; ++first, ++inserted)
+		it = emplace(++it, *first);
+	while (--inserted)														//         -
+		--it;																//    ,   
+	return it;
+}
+
+template <class T, size_t NodeCapacity>
+typename MyUnrolledList<T, NodeCapacity>::iterator MyUnrolledList<T, NodeCapacity>::normalize(Node* node, size_t pos) noexcept {
+	if (!node->count)
+	{
+		Node* next{ node->n };
+		destroy_node(node);
+		return iterator(next, 0, this);
+	}
+	Node* next{ node->n };
+	if (next != my_end && node->count + next->count <= NodeCapacity / 2)	//   ,   
+	{
+		for (size_t i = 0; i < next->count; ++i)
+			relocate(node->data() + node->count + i, next->data() + i);
+		node->count += next->count;
+		destroy_node(next);
+	}
+	if (pos == node->count)
+		return iterator(node->n, 0, this);
+	return iterator(node, pos, this);
+}
+
+template <class T, size_t NodeCapacity>
+typename MyUnrolledList<T, NodeCapacity>::iterator MyUnrolledList<T, NodeCapacity>::erase(iterator target) noexcept {
+	CONTAINER_VERIFY(target.my_node != target.my_cont->my_end, "Can't delete end element");
+	CONTAINER_VERIFY(target.my_cont == this, "Can't erase from another container");
+	if (is_shared())
+		detach_helper(std::addressof(target.my_node));
+	Node* node{ target.my_node };
+	T* cells{ node->data() };
+	cells[target.my_pos].~T();
+	for (size_t i = target.my_pos + 1; i < node->count; ++i)
+		relocate(cells + i - 1, cells + i);
+	--node->count;
+	--my_size;
+	return normalize(node, target.my_pos);
+}
+
+template <class T, size_t NodeCapacity>
+typename MyUnrolledList<T, NodeCapacity>::iterator MyUnrolledList<T, NodeCapacity>::erase(iterator first, iterator last) noexcept {
+	CONTAINER_VERIFY(first.my_cont == last.my_cont, "Can't erase by iterators from different containers");
+	CONTAINER_VERIFY(first.my_cont == this, "Can't erase from another container");
+	if (first == last)
+		return last;
+	if (is_shared())
+		detach_helper(std::addressof(first.my_node), std::addressof(last.my_node));
+	size_t count{ 0 };
+	for (iterator it = first; it != last; ++it)								// last   ,    
+		++count;
+	while (count--)
+		first = erase(first);
+	return first;
+}
+
+template <class T, size_t NodeCapacity>
+bool MyUnrolledList<T, NodeCapacity>::contains(const T& val) const noexcept {
+	if (my_end)
+		for (Node* cur = my_end->n; cur != my_end; cur = cur->n)			//        
+			for (const T* it = cur->data(), *last = it + cur->count; it != last; ++it)
+				if (*it == val)
+					return true;
+	return false;
+}
+
+template <class T, size_t NodeCapacity>
+size_t MyUnrolledList<T, NodeCapacity>::count(const T& val) const noexcept {
+	size_t count{ 0 };
+	if (my_end)
+		for (Node* cur = my_end->n; cur != my_end; cur = cur->n)
+			for (const T* it = cur->data(), *last = it + cur->count; it != last; ++it)
+				count += (*it == val);
+	return count;
+}
+
+template <class T, size_t NodeCapacity>
+template<class Predicate>
+size_t MyUnrolledList<T, NodeCapacity>::remove_helper(Predicate pred) {
+	if (empty())
+		return 0;
+	if (is_shared())														//  ,     
+	{
+		if (std::none_of(cbegin(), cend(), [&pred](const T& val) { return static_cast<bool>(pred(val)); }))
+			return 0;
+		detach_helper();
+	}
+	Node* writer{ my_end->n };												//  :      
+	size_t write_pos{ 0 }, count{ 0 };
+	for (Node* reader = my_end->n; reader != my_end; reader = reader->n)
+	{
+		T* cells{ reader->data() };
+		for (size_t read_pos = 0; read_pos < reader->count; ++read_pos)
+		{
+			if (pred(cells[read_pos]))
+			{
+				cells[read_pos].~T();
+				++count;
+				continue;
+			}
+			if (write_pos == NodeCapacity)
+			{
+				writer->count = NodeCapacity;
+				writer = writer->n;
+				write_pos = 0;
+			}
+			if (writer != reader || write_pos != read_pos)
+				relocate(writer->data() + write_pos, cells + read_pos);
+			++write_pos;
+		}
+	}
+	writer->count = write_pos;
+	if (!write_pos)
+		writer = writer->p;
+	while (writer->n != my_end)												//     
+		destroy_node(writer->n);
+	my_size -= count;
+	return count;
+}
+
+template <class T, size_t NodeCapacity>
+template<class Predicate>
+void MyUnrolledList<T, NodeCapacity>::sort(iterator begin, iterator end, Predicate comparator) {
+	CONTAINER_VERIFY(begin.my_cont == this && end.my_cont == this, "Can't sort by iterators from another container");
+	if (begin == end)
+		return;
+	if (is_shared())
+		detach_helper(std::addressof(begin.my_node), std::addressof(end.my_node));
+	std::vector<T*> order;													// :     
+	for (iterator it = begin; it != end; ++it)
+		order.push_back(std::addressof(*it));
+	std::stable_sort(order.begin(), order.end(), [&comparator](const T* left, const T* right) { return PRED_TO_BOOL(comparator, *left, *right); });
+	std::vector<T> buffer;													//   :   
+	buffer.reserve(order.size());
+	for (T* val : order)
+		buffer.push_back(std::move_if_noexcept(*val));
+	auto val = buffer.begin();
+	for (iterator it = begin; it != end; ++it, ++val)
+		*it = std::move(*val);
+}
+
+template <class T, size_t NodeCapacity>
+MyUnrolledList<T, NodeCapacity>& MyUnrolledList<T, NodeCapacity>::operator+=(const MyUnrolledList& o) {
+	if (!o.empty())
+	{
+		if (is_shared())
+			detach_helper();
+		copy_helper(o.cbegin(), o.cend());
+	}
+	return *this;
+}
+
+template <class T, size_t NodeCapacity>
+bool MyUnrolledList<T, NodeCapacity>::operator==(const MyUnrolledList& o) const {
+	if (my_size != o.my_size)
+		return false;
+	if (alc == o.alc || !my_size)
+		return true;
+	Node* left{ my_end->n }, * right{ o.my_end->n };						//     -    
+	size_t left_pos{ 0 }, right_pos{ 0 };
+	while (left != my_end)
+	{
+		size_t span{ std::min(left->count - left_pos, right->count - right_pos) };
+		const T* left_val{ left->data() + left_pos }, * right_val{ right->data() + right_pos };
+		for (size_t i = 0; i < span; ++i)
+			if (left_val[i] != right_val[i])
+				return false;
+		if ((left_pos += span) == left->count)
+		{
+			left = left->n;
+			left_pos = 0;
+		}
+		if ((right_pos += span) == right->count)
+		{
+			right = right->n;
+			right_pos = 0;
+		}
+	}
+	return true;
+}
+
+template <class T, size_t NodeCapacity>
+typename MyUnrolledList<T, NodeCapacity>::iterator& MyUnrolledList<T, NodeCapacity>::iterator::operator+=(int offset) noexcept {
+	if (offset > 0)
+	{
+		size_t rest{ static_cast<size_t>(offset) };
+		while (rest && my_node != my_cont->my_end && my_pos + rest >= my_node->count)
+		{
+			rest -= my_node->count - my_pos;
+			my_node = my_node->n;
+			my_pos = 0;
+		}
+		CONTAINER_VERIFY(!rest || my_node != my_cont->my_end, "Can't increment end list iterator");
+		my_pos += rest;
+	}
+	else
+	{
+		size_t rest{ static_cast<size_t>(-static_cast<long long>(offset)) };
+		while (rest > my_pos)
+		{
+			rest -= my_pos + 1;
+			my_node = my_node->p;
+			CONTAINER_VERIFY(my_node != my_cont->my_end, "Can't decrement begin list iterator");
+			my_pos = my_node->count - 1;
+		}
+		my_pos -= rest;
+	}
+	return *this;
+}
+#endif	//MyUnrolledList_H
@@ -0,0 +1,103 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#include "MyCompactList.h"
+#include "MyLinkedList.h"
+#include <list>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace bench {
+	inline unsigned scramble(size_t i) noexcept { return static_cast<unsigned>(i * 2654435761u) >> 4; }
+
+	volatile size_t sink;													//    
+
+	template <class C> struct Container;
+	template <> struct Container<MyCompactList<int>> {
+		static constexpr const char* name{ "MyCompactList" };
+		static size_t bytes(const MyCompactList<int>& c) { return c.allocator_statistics().bytes_reserved; }
+	};
+	template <> struct Container<MyLinkedList<int>> {
+		static constexpr const char* name{ "MyLinkedList" };
+		static size_t bytes(const MyLinkedList<int>& c) { return c.allocator_statistics().allocated_blocks * 24; }	// -    int  
+	};
+	template <> struct Container<std::list<int>> {
+		static constexpr const char* name{ "std::list" };
+		static size_t bytes(const std::list<int>& c) { return c.size() * 32; }	//24      malloc
+	};
+
+	struct Options {
+		std::vector<size_t> lengths{ 100000, 1000000, 10000000 };
+		int repeats{ 3 };
+		const char* filter{ nullptr };										//    
+	};
+
+	inline bool enabled(const Options& opt, const char* operation, const char* name)
+	{ return !opt.filter || std::strstr(operation, opt.filter) || std::strstr(name, opt.filter); }
+
+	template <class C>
+	void run(const Options& opt, size_t length) {							//fill - push_back, scan -    , churn -     
+		double fill_ms{ 1e300 }, scan_ms{ 1e300 }, churn_ms{ 1e300 }, rescan_ms{ 1e300 };	//rescan -   churn,       
+		size_t bytes{ 0 };
+		for (int r = 0; r < opt.repeats; ++r)
+		{
+			C c;
+			auto start{ std::chrono::steady_clock::now() };
+			for (size_t i = 0; i < length; ++i)
+				c.push_back(static_cast<int>(scramble(i)));
+			auto filled{ std::chrono::steady_clock::now() };
+			size_t sum{ 0 };
+			for (int val : c)
+				sum += static_cast<unsigned>(val);
+			sink = sum;
+			auto scanned{ std::chrono::steady_clock::now() };
+			c.remove_if([](int val) { return val & 1; });
+			for (size_t i = c.size(); i < length; ++i)
+				c.push_back(static_cast<int>(scramble(i)));
+			auto churned{ std::chrono::steady_clock::now() };
+			sum = 0;
+			for (int val : c)
+				sum += static_cast<unsigned>(val);
+			sink = sum;
+			auto rescanned{ std::chrono::steady_clock::now() };
+			fill_ms = std::min(fill_ms, std::chrono::duration<double, std::milli>(filled - start).count());
+			scan_ms = std::min(scan_ms, std::chrono::duration<double, std::milli>(scanned - filled).count());
+			churn_ms = std::min(churn_ms, std::chrono::duration<double, std::milli>(churned - scanned).count());
+			rescan_ms = std::min(rescan_ms, std::chrono::duration<double, std::milli>(rescanned - churned).count());
+			bytes = Container<C>::bytes(c);
+		}
+		const char* operations[]{ "fill", "scan", "churn", "rescan" };
+		double results[]{ fill_ms, scan_ms, churn_ms, rescan_ms };
+		for (size_t i = 0; i < 4; ++i)
+			if (enabled(opt, operations[i], Container<C>::name))
+				std::printf("%-8s %-14s %10zu %12.3f %10.2f %10.1f\n", operations[i], Container<C>::name, length, results[i], results[i] * 1e6 / length, static_cast<double>(bytes) / length);
+	}
+}
+
+int main(int argc, char** argv) {											//MyCompactListBenchmark [-r repeats] [-f operation] [length...]
+	bench::Options opt;
+	std::vector<size_t> lengths;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (!std::strcmp(argv[i], "-r") && i + 1 < argc)
+			opt.repeats = std::atoi(argv[++i]);
+		else if (!std::strcmp(argv[i], "-f") && i + 1 < argc)
+			opt.filter = argv[++i];
+		else
+			lengths.push_back(std::strtoull(argv[i], nullptr, 10));
+	}
+	if (!lengths.empty())
+		opt.lengths = lengths;
+	std::printf("%-8s %-14s %10s %12s %10s %10s\n", "op", "list", "length", "best ms", "ns/elem", "bytes/elem");
+	for (size_t length : opt.lengths)
+	{
+		bench::run<MyCompactList<int>>(opt, length);
+		bench::run<MyLinkedList<int>>(opt, length);
+		bench::run<std::list<int>>(opt, length);
+	}
+	return 0;
+}
@@ -0,0 +1,105 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#include "MyLinkedList.h"
+#include "MyConcurrentListAllocator.h"
+#include <thread>
+#include <mutex>
+#include <vector>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+
+namespace check {
+	using List = MyLinkedList<size_t, MyConcurrentListAllocator>;
+
+	struct Options {
+		size_t threads{ 4 };
+		size_t rounds{ 200 };
+		size_t length{ 5000 };
+	};
+
+	class Mailbox {															//,   :    ,   
+	public:
+		void put(List&& list) { std::lock_guard<std::mutex> lock{ mutex }; lists.push_back(std::move(list)); }
+		bool take(List& list) {
+			std::lock_guard<std::mutex> lock{ mutex };
+			if (lists.empty())
+				return false;
+			list = std::move(lists.back());
+			lists.pop_back();
+			return true;
+		}
+	private:
+		std::mutex mutex;
+		std::vector<List> lists;
+	};
+
+	std::atomic<size_t> failures{ 0 };
+
+	inline size_t expected_sum(size_t first, size_t length) noexcept { return length * first + length * (length - 1) / 2; }
+
+	void verify(const List& list, size_t first, size_t length) {			//  first, first + 1, ... -     
+		size_t sum{ 0 };
+		for (size_t val : list)
+			sum += val;
+		if (list.size() != length || sum != expected_sum(first, length))
+			failures.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void worker(const Options& opt, size_t index, std::vector<Mailbox>& boxes, const List::Family* family) {
+		for (size_t round = 0; round < opt.rounds; ++round)
+		{
+			List list{ family ? List(*family) : List() };
+			size_t first{ (index * opt.rounds + round) * opt.length };
+			for (size_t i = 0; i < opt.length; ++i)						//     
+				list.push_back(first + i);
+			verify(list.as_const(), first, opt.length);
+			boxes[(index + 1) % opt.threads].put(std::move(list));
+			List received{ family ? List(*family) : List() };
+			while (boxes[index].take(received))							//          
+			{
+				size_t received_first{ received.front() };
+				for (size_t i = 0; i < opt.length / 2; ++i)
+					received.pop_front();
+				for (size_t i = 0; i < opt.length / 2; ++i)
+					received.push_front(received_first + opt.length / 2 - 1 - i);
+				verify(received.as_const(), received_first, opt.length);
+				received.clear();
+			}
+		}
+	}
+
+	bool run(const Options& opt, bool shared_family) {
+		failures = 0;
+		std::vector<Mailbox> boxes(opt.threads);
+		{
+			List::Family family;											//        
+			std::vector<std::thread> threads;
+			for (size_t i = 0; i < opt.threads; ++i)
+				threads.emplace_back(worker, std::cref(opt), i, std::ref(boxes), shared_family ? &family : nullptr);
+			for (std::thread& thread : threads)
+				thread.join();												//     
+			List rest{ shared_family ? List(family) : List() };
+			for (Mailbox& box : boxes)
+				while (box.take(rest))
+					verify(rest.as_const(), rest.front(), opt.length);
+		}
+		std::printf("%-34s %8zu %8zu %8zu  %s\n", shared_family ? "shared Family" : "own storage per list", opt.threads, opt.rounds, opt.length, failures ? "FAILED" : "ok");
+		return !failures;
+	}
+}
+
+int main(int argc, char** argv) {											//MyConcurrentAllocatorCheck [threads] [rounds] [length].       
+	check::Options opt;
+	if (argc > 1)
+		opt.threads = std::strtoull(argv[1], nullptr, 10);
+	if (argc > 2)
+		opt.rounds = std::strtoull(argv[2], nullptr, 10);
+	if (argc > 3)
+		opt.length = std::strtoull(argv[3], nullptr, 10);
+	std::printf("%-34s %8s %8s %8s\n", "build/teardown across threads", "threads", "rounds", "length");
+	bool ok{ check::run(opt, false) };
+	ok = check::run(opt, true) && ok;
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,87 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#include "MyConcurrentQueue.h"
+#include "MyLinkedList.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace bench {
+	class LockedList {														//   MyLinkedList   
+	private:
+		std::mutex guard;
+		MyLinkedList<size_t> list;
+	public:
+		inline void push(size_t val) { std::lock_guard<std::mutex> lock{ guard }; list.push_back(val); }
+		inline bool try_pop(size_t& val) { std::lock_guard<std::mutex> lock{ guard }; if (list.empty()) return false; val = list.takeFirst(); return true; }
+	};
+
+	struct Result {
+		double ms;
+		bool valid;
+	};
+
+	template <class Queue>
+	Result run(size_t producers, size_t consumers, size_t items) {			//   items ,     
+		Queue queue;
+		std::atomic<size_t> popped{ 0 }, checksum{ 0 };
+		std::atomic<bool> start{ false };
+		std::vector<std::thread> threads;
+		for (size_t p = 0; p < producers; ++p)
+			threads.emplace_back([&, p] {
+				while (!start.load(std::memory_order_acquire))
+					std::this_thread::yield();
+				for (size_t i = 0; i < items; ++i)
+					queue.push(p * items + i + 1);
+			});
+		const size_t total{ producers * items };
+		for (size_t c = 0; c < consumers; ++c)
+			threads.emplace_back([&] {
+				while (!start.load(std::memory_order_acquire))
+					std::this_thread::yield();
+				size_t val, sum{ 0 }, count{ 0 };
+				while (popped.load(std::memory_order_relaxed) < total)
+					if (queue.try_pop(val))
+					{
+						sum += val;
+						++count;
+						popped.fetch_add(1, std::memory_order_relaxed);
+					}
+					else
+						std::this_thread::yield();
+				checksum.fetch_add(sum);
+			});
+		auto begin{ std::chrono::steady_clock::now() };
+		start.store(true, std::memory_order_release);
+		for (std::thread& thread : threads)
+			thread.join();
+		std::chrono::duration<double, std::milli> elapsed{ std::chrono::steady_clock::now() - begin };
+		return { elapsed.count(), popped.load() == total && checksum.load() == total * (total + 1) / 2 };
+	}
+}
+
+int main(int argc, char** argv) {											//MyConcurrentQueueBenchmark [items per producer] [threads...]
+	size_t items{ argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000 };
+	std::vector<size_t> thread_counts;
+	for (int i = 2; i < argc; ++i)
+		thread_counts.push_back(std::strtoull(argv[i], nullptr, 10));
+	if (thread_counts.empty())
+		thread_counts = { 1, 2, 4, 8 };
+	bool valid{ true };
+	std::printf("%-26s %10s %10s %12s %12s\n", "queue", "producers", "consumers", "items", "ms");
+	for (size_t threads : thread_counts)
+	{
+		bench::Result lock_free{ bench::run<MyConcurrentQueue<size_t>>(threads, threads, items) };
+		bench::Result locked{ bench::run<bench::LockedList>(threads, threads, items) };
+		std::printf("%-26s %10zu %10zu %12zu %12.3f%s\n", "MyConcurrentQueue", threads, threads, threads * items, lock_free.ms, lock_free.valid ? "" : "  FAILED");
+		std::printf("%-26s %10zu %10zu %12zu %12.3f%s\n", "MyLinkedList + std::mutex", threads, threads, threads * items, locked.ms, locked.valid ? "" : "  FAILED");
+		valid = valid && lock_free.valid && locked.valid;
+	}
+	return valid ? 0 : 1;
+}
@@ -0,0 +1,374 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#include "MyLinkedList.h"
+#include "MyUnrolledList.h"
+#include "MyPersistentList.h"
+#include <list>
+#include <deque>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+
+namespace bench {
+	template <size_t Bytes>
+	struct Payload {														//      
+		unsigned key;
+		unsigned char pad[Bytes - sizeof(unsigned)];
+		inline Payload(unsigned val = 0) noexcept : key{ val } { std::memset(pad, static_cast<int>(val), sizeof(pad)); }
+		inline bool operator==(const Payload& o) const noexcept { return key == o.key; }
+		inline bool operator!=(const Payload& o) const noexcept { return key != o.key; }
+		inline bool operator<(const Payload& o) const noexcept { return key < o.key; }
+	};
+
+	inline unsigned key_of(unsigned val) noexcept { return val; }
+	template <size_t Bytes> inline unsigned key_of(const Payload<Bytes>& val) noexcept { return val.key; }
+
+	inline unsigned scramble(size_t i) noexcept { return static_cast<unsigned>(i * 2654435761u) >> 4; }	//   
+
+	volatile size_t sink;													//    
+
+	template <class C> struct Container { static constexpr bool my_list{ false }, std_list{ false }, vector{ false }; };
+	template <class T> struct Container<MyLinkedList<T>> { static constexpr const char* name{ "MyLinkedList" }; static constexpr bool my_list{ true }, std_list{ false }, vector{ false }; };
+	template <class T, size_t N> struct Container<MyUnrolledList<T, N>> { static constexpr const char* name{ "MyUnrolledList" }; static constexpr bool my_list{ true }, std_list{ false }, vector{ false }; };
+	template <class T, size_t L, size_t B> struct Container<MyPersistentList<T, L, B>> { static constexpr const char* name{ "MyPersistentList" }; static constexpr bool my_list{ false }, std_list{ false }, vector{ false }; };
+	template <class T> struct Container<std::list<T>> { static constexpr const char* name{ "std::list" }; static constexpr bool my_list{ false }, std_list{ true }, vector{ false }; };
+	template <class T> struct Container<std::deque<T>> { static constexpr const char* name{ "std::deque" }; static constexpr bool my_list{ false }, std_list{ false }, vector{ false }; };
+	template <class T> struct Container<std::vector<T>> { static constexpr const char* name{ "std::vector" }; static constexpr bool my_list{ false }, std_list{ false }, vector{ true }; };
+
+	struct Options {
+		std::vector<size_t> lengths{ 1000, 100000, 1000000 };
+		int repeats{ 3 };
+		const char* filter{ nullptr };										//  
+	};
+
+	template <class State, class Setup, class Run>
+	double measure(const Options& opt, Setup setup, Run run) {				//    ,   
+		double best{ 1e300 };
+		for (int r = 0; r < opt.repeats; ++r)
+		{
+			State state;
+			setup(state);
+			auto start{ std::chrono::steady_clock::now() };
+			run(state);
+			std::chrono::duration<double, std::milli> elapsed{ std::chrono::steady_clock::now() - start };
+			best = std::min(best, elapsed.count());
+		}
+		return best;
+	}
+
+	template <class C>
+	void report(const Options&, const char* operation, size_t length, double ms) {
+		std::printf("%-22s %-16s %6zu %10zu %12.3f\n", operation, Container<C>::name, sizeof(typename C::value_type), length, ms);
+	}
+
+	inline bool enabled(const Options& opt, const char* operation) { return !opt.filter || std::strstr(operation, opt.filter); }
+
+	template <class C>
+	void fill(C& c, size_t length, bool random_keys = false) {
+		using E = typename C::value_type;
+		for (size_t i = 0; i < length; ++i)
+			c.push_back(E(random_keys ? scramble(i) : static_cast<unsigned>(i)));
+	}
+
+	template <class C>
+	typename C::iterator advanced(C& c, size_t offset) {
+		auto it{ c.begin() };
+		for (; offset > 0; --offset)
+			++it;
+		return it;
+	}
+
+	template <class C>
+	void run_container(const Options& opt, size_t length) {
+		using E = typename C::value_type;
+		struct Plain { C c; };
+		struct Positioned { C c; typename C::iterator first, last; };
+		struct Copied { C c, copy; };
+
+		if (enabled(opt, "push_back"))
+			report<C>(opt, "push_back", length, measure<Plain>(opt, [](Plain&) {},
+				[length](Plain& s) { fill(s.c, length); }));
+
+		if constexpr (!Container<C>::vector)
+			if (enabled(opt, "push_front"))
+				report<C>(opt, "push_front", length, measure<Plain>(opt, [](Plain&) {},
+					[length](Plain& s) { for (size_t i = 0; i < length; ++i) s.c.push_front(E(static_cast<unsigned>(i))); }));
+
+		constexpr size_t inserts{ 256 };
+		if (enabled(opt, "emplace_middle"))
+			report<C>(opt, "emplace_middle", length, measure<Positioned>(opt,
+				[length](Positioned& s) { fill(s.c, length); s.first = advanced(s.c, length / 2); },
+				[](Positioned& s) {
+					for (size_t i = 0; i < inserts; ++i)
+						if constexpr (Container<C>::my_list || Container<C>::std_list)
+							s.first = s.c.emplace(s.first, static_cast<unsigned>(i));
+						else
+							s.c.emplace(s.c.begin() + s.c.size() / 2, static_cast<unsigned>(i));
+				}));
+
+		if (enabled(opt, "erase_range"))
+			report<C>(opt, "erase_range", length, measure<Positioned>(opt,
+				[length](Positioned& s) { fill(s.c, length); s.first = advanced(s.c, length / 4); s.last = advanced(s.c, length - length / 4); },
+				[](Positioned& s) { s.c.erase(s.first, s.last); }));
+
+		if (enabled(opt, "sort"))
+			report<C>(opt, "sort", length, measure<Plain>(opt, [length](Plain& s) { fill(s.c, length, true); },
+				[](Plain& s) {
+					if constexpr (Container<C>::my_list || Container<C>::std_list)
+						s.c.sort();
+					else
+						std::sort(s.c.begin(), s.c.end());
+				}));
+
+		if constexpr (!Container<C>::std_list)
+			if (enabled(opt, "sort_range") && length > 2)
+				report<C>(opt, "sort_range", length, measure<Positioned>(opt,
+					[length](Positioned& s) { fill(s.c, length, true); s.first = advanced(s.c, 1); s.last = advanced(s.c, length - 1); },
+					[](Positioned& s) {
+						if constexpr (Container<C>::my_list)
+							s.c.sort(s.first, s.last);
+						else
+							std::sort(s.first, s.last);
+					}));
+
+		if (enabled(opt, "remove_if"))
+			report<C>(opt, "remove_if", length, measure<Plain>(opt, [length](Plain& s) { fill(s.c, length, true); },
+				[](Plain& s) {
+					auto odd{ [](const E& val) { return key_of(val) & 1; } };
+					if constexpr (Container<C>::my_list || Container<C>::std_list)
+						s.c.remove_if(odd);
+					else
+						s.c.erase(std::remove_if(s.c.begin(), s.c.end(), odd), s.c.end());
+				}));
+
+		if (enabled(opt, "iterate"))
+			report<C>(opt, "iterate", length, measure<Plain>(opt, [length](Plain& s) { fill(s.c, length); },
+				[](Plain& s) {
+					size_t sum{ 0 };
+					for (const E& val : static_cast<const C&>(s.c))
+						sum += key_of(val);
+					sink = sum;
+				}));
+
+		if (enabled(opt, "copy_then_mutate"))								// MyLinkedList -    detach_helper   
+			report<C>(opt, "copy_then_mutate", length, measure<Copied>(opt, [length](Copied& s) { fill(s.c, length); },
+				[](Copied& s) { s.copy = s.c; s.copy.push_back(E(0u)); }));
+
+		if (enabled(opt, "append_batches"))									//    10K
+		{
+			std::vector<E> records;
+			for (size_t i = 0; i < std::min<size_t>(10000, length); ++i)
+				records.push_back(E(static_cast<unsigned>(i)));
+			report<C>(opt, "append_batches", length, measure<Plain>(opt, [](Plain&) {},
+				[length, &records](Plain& s) {
+					for (size_t done = 0; done < length; done += records.size())
+						if constexpr (std::is_same<C, MyLinkedList<E>>::value)
+							s.c.append_range(records);
+						else
+							s.c.insert(s.c.end(), records.begin(), records.end());
+				}));
+		}
+
+		if constexpr (Container<C>::my_list || Container<C>::vector)
+			if (enabled(opt, "reserve_push_back"))
+				report<C>(opt, "reserve_push_back", length, measure<Plain>(opt, [](Plain&) {},
+					[length](Plain& s) {
+						if constexpr (Container<C>::my_list)
+							s.c.push_back(E(0u));								// MyLinkedList    
+						s.c.reserve(length);
+						fill(s.c, length);
+					}));
+	}
+
+	template <class C>
+	void run_snapshots(const Options& opt, size_t length) {				//   ,   -  
+		using E = typename C::value_type;
+		constexpr size_t snapshots{ 16 };
+		struct Snapshots { C c; std::vector<C> copies; };
+		if (enabled(opt, "snapshot_edit"))
+			report<C>(opt, "snapshot_edit", length, measure<Snapshots>(opt, [length](Snapshots& s) { fill(s.c, length); },
+				[](Snapshots& s) {
+					for (size_t i = 0; i < snapshots; ++i)
+					{
+						s.copies.push_back(s.c);
+						s.copies.back().push_back(E(static_cast<unsigned>(i)));
+					}
+				}));
+	}
+
+	template <class C>
+	void run_moves(const Options& opt, size_t length, const char* operation) {	//      
+		constexpr size_t states{ 4 };
+		struct Lists { std::vector<C> lists; };
+		if (enabled(opt, operation) && length >= states)
+			report<C>(opt, operation, length, measure<Lists>(opt,
+				[length, operation](Lists& s) {
+					if constexpr (Container<C>::my_list)					// MyLinkedList -        
+					{
+						typename C::Family family;							// ,       
+						for (size_t i = 0; i < states; ++i)
+							s.lists.push_back(std::strstr(operation, "family") ? C(family) : C());
+					}
+					else
+						s.lists.resize(states);
+					for (size_t i = 0; i < length; ++i)
+						s.lists[i % states].push_back(typename C::value_type(static_cast<unsigned>(i)));
+				},
+				[length](Lists& s) {
+					for (size_t i = 0; i < length; ++i)
+					{
+						C& from{ s.lists[i % states] }, & to{ s.lists[(i + 1) % states] };
+						to.splice(to.end(), from, from.begin());
+					}
+				}));
+	}
+
+	template <class C>
+	void run_concat(const Options& opt, size_t length, const char* operation) {	//     
+		constexpr size_t parts{ 64 };
+		struct Parts { C result; std::vector<C> parts; };
+		if (enabled(opt, operation) && length >= parts)
+			report<C>(opt, operation, length, measure<Parts>(opt,
+				[length](Parts& s) {
+					s.parts.resize(parts);
+					for (size_t i = 0; i < length; ++i)
+						s.parts[i * parts / length].push_back(typename C::value_type(static_cast<unsigned>(i)));
+				},
+				[operation](Parts& s) {
+					for (C& part : s.parts)
+						if constexpr (Container<C>::std_list)
+							s.result.splice(s.result.end(), part);
+						else if (std::strstr(operation, "copy"))
+							s.result += part;
+						else
+							s.result += std::move(part);
+				}));
+	}
+
+	template <class C>
+	void run_pages(const Options& opt, size_t length, const char* operation) {	// :   20    
+		constexpr size_t pages{ 1000 }, page_size{ 20 };
+		struct Plain { C c; };
+		if (enabled(opt, operation) && length > page_size)
+			report<C>(opt, operation, length, measure<Plain>(opt,
+				[length, operation](Plain& s) {
+					if constexpr (Container<C>::my_list)
+						if (std::strstr(operation, "indexed"))
+							s.c.enable_index();
+					fill(s.c, length);
+					if constexpr (Container<C>::my_list)
+						sink = key_of(s.c.as_const().at(length / 2));				//     -  
+				},
+				[length](Plain& s) {
+					const C& c{ s.c };
+					size_t sum{ 0 };
+					for (size_t page = 0; page < pages; ++page)
+					{
+						auto it{ c.begin() };
+						if constexpr (Container<C>::std_list)
+							std::advance(it, scramble(page) % (length - page_size));
+						else
+							it += static_cast<int>(scramble(page) % (length - page_size));
+						for (size_t i = 0; i < page_size; ++i, ++it)
+							sum += key_of(*it);
+					}
+					sink = sum;
+				}));
+	}
+
+	template <class C>
+	void run_scans(const Options& opt, size_t length, const char* operation) {	//   -  .     L3,    10M
+		using E = typename C::value_type;
+		struct Pair { C c, o; };
+		if (!enabled(opt, operation))
+			return;
+		bool shuffled{ std::strstr(operation, "shuffled") != nullptr };		//        
+		report<C>(opt, operation, length, measure<Pair>(opt,
+			[length, shuffled](Pair& s) {
+				fill(s.c, length, shuffled);
+				fill(s.o, length, shuffled);								// :   MyLinkedList  ,  operator==    
+				if (shuffled)
+				{
+					s.c.sort();
+					s.o.sort();
+				}
+			},
+			[operation](Pair& s) {
+				const C& c{ s.c };
+				const E missing(~0u);
+				if (std::strstr(operation, "iterator"))						//   
+					sink = std::find(c.begin(), c.end(), missing) != c.end();
+				else if (std::strstr(operation, "equal"))
+					sink = c == s.o;
+				else if constexpr (Container<C>::my_list)
+				{
+					if (std::strstr(operation, "contains"))
+						sink = c.contains(missing);
+					else if (std::strstr(operation, "count"))
+						sink = c.count(missing);
+					else
+						sink = c.find(missing) != c.end();
+				}
+				else if (std::strstr(operation, "count"))
+					sink = static_cast<size_t>(std::count(c.begin(), c.end(), missing));
+				else
+					sink = std::find(c.begin(), c.end(), missing) != c.end();
+			}));
+	}
+
+	template <class E>
+	void run_element(const Options& opt) {
+		for (size_t length : opt.lengths)
+		{
+			run_container<MyLinkedList<E>>(opt, length);
+			run_container<MyUnrolledList<E>>(opt, length);
+			run_container<std::list<E>>(opt, length);
+			run_container<std::deque<E>>(opt, length);
+			run_container<std::vector<E>>(opt, length);
+			run_snapshots<MyLinkedList<E>>(opt, length);
+			run_snapshots<MyPersistentList<E>>(opt, length);
+			run_moves<MyLinkedList<E>>(opt, length, "state_moves_family");
+			run_moves<MyLinkedList<E>>(opt, length, "state_moves");
+			run_moves<std::list<E>>(opt, length, "state_moves");
+			run_concat<MyLinkedList<E>>(opt, length, "concat_move");
+			run_concat<MyLinkedList<E>>(opt, length, "concat_copy");
+			run_concat<std::list<E>>(opt, length, "concat_move");
+			run_pages<MyLinkedList<E>>(opt, length, "page_offset");
+			run_pages<MyLinkedList<E>>(opt, length, "page_offset_indexed");
+			run_pages<std::list<E>>(opt, length, "page_offset");
+			run_pages<std::vector<E>>(opt, length, "page_offset");
+			for (const char* operation : { "scan_contains", "scan_count", "scan_find", "scan_equal", "scan_contains_shuffled", "scan_count_shuffled", "scan_find_shuffled", "scan_equal_shuffled" })
+			{
+				run_scans<MyLinkedList<E>>(opt, length, operation);
+				run_scans<std::list<E>>(opt, length, operation);
+			}
+			run_scans<MyLinkedList<E>>(opt, length, "scan_find_iterator");
+			run_scans<MyLinkedList<E>>(opt, length, "scan_find_iterator_shuffled");
+		}
+	}
+}
+
+int main(int argc, char** argv) {											//MyLinkedListBenchmark [-r repeats] [-f operation] [length...]
+	bench::Options opt;
+	std::vector<size_t> lengths;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (!std::strcmp(argv[i], "-r") && i + 1 < argc)
+			opt.repeats = std::atoi(argv[++i]);
+		else if (!std::strcmp(argv[i], "-f") && i + 1 < argc)
+			opt.filter = argv[++i];
+		else
+			lengths.push_back(std::strtoull(argv[i], nullptr, 10));
+	}
+	if (!lengths.empty())
+		opt.lengths = lengths;
+	std::printf("%-22s %-16s %6s %10s %12s\n", "operation", "container", "bytes", "length", "best ms");
+	bench::run_element<unsigned>(opt);
+	bench::run_element<bench::Payload<64>>(opt);
+	return 0;
+}
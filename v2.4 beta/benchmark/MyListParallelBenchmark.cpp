@@ -0,0 +1,134 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#include "MyLinkedList.h"
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace bench {
+	inline unsigned scramble(size_t i) noexcept { return static_cast<unsigned>(i * 2654435761u) >> 4; }
+
+	volatile size_t sink;													//    
+
+	enum class Input { ordered, shuffled };									//shuffled:         
+	constexpr Input inputs[]{ Input::ordered, Input::shuffled };
+	inline const char* input_name(Input input) noexcept { return input == Input::ordered ? "ordered" : "shuffled"; }
+
+	struct Options {
+		std::vector<size_t> lengths{ 1000000 };
+		std::vector<size_t> threads;										//  - 1, 2, 4...   
+		unsigned work{ 64 };												//    -  "" 
+		int repeats{ 3 };
+		const char* filter{ nullptr };										//  
+	};
+
+	inline unsigned hash(unsigned val, unsigned rounds) noexcept {			//    
+		for (unsigned i = 0; i < rounds; ++i)
+			val = (val ^ (val >> 15)) * 2246822519u + i;
+		return val;
+	}
+
+	template <class Setup, class Run>
+	double measure(const Options& opt, Setup setup, Run run) {				//    ,   
+		double best{ 1e300 };
+		for (int r = 0; r < opt.repeats; ++r)
+		{
+			MyLinkedList<unsigned> list;
+			setup(list);
+			auto start{ std::chrono::steady_clock::now() };
+			run(list);
+			std::chrono::duration<double, std::milli> elapsed{ std::chrono::steady_clock::now() - start };
+			best = std::min(best, elapsed.count());
+		}
+		return best;
+	}
+
+	inline bool enabled(const Options& opt, const char* operation) { return !opt.filter || std::strstr(operation, opt.filter); }
+
+	inline void report(const char* operation, Input input, size_t length, size_t threads, double ms, double baseline) {
+		std::printf("%-18s %-10s %10zu %8zu %12.3f %8.2fx\n", operation, input_name(input), length, threads, ms, baseline / ms);
+	}
+
+	inline void fill(MyLinkedList<unsigned>& list, size_t length, Input input) {
+		for (size_t i = 0; i < length; ++i)
+			list.push_back(input == Input::shuffled ? scramble(i) : static_cast<unsigned>(i));
+		if (input == Input::shuffled)
+			list.sort();
+	}
+
+	template <class Serial, class Parallel>
+	void run_operation(const Options& opt, const char* operation, size_t length, Input input, Serial serial, Parallel parallel) {
+		if (!enabled(opt, operation))
+			return;
+		auto setup{ [length, input](MyLinkedList<unsigned>& list) { fill(list, length, input); } };
+		double baseline{ measure(opt, setup, serial) };						//    
+		report(operation, input, length, 0, baseline, baseline);
+		for (size_t threads : opt.threads)
+			report(operation, input, length, threads, measure(opt, setup, [&parallel, threads](MyLinkedList<unsigned>& list) { parallel(list, threads); }), baseline);
+	}
+
+	void run_length(const Options& opt, size_t length, Input input) {
+		unsigned work{ opt.work };
+		auto heavy{ [work](unsigned val) { return (hash(val, work) & 7) == 0; } };
+		unsigned target{ static_cast<unsigned>(length * 3 / 4) };				//    3/4  
+		if (input == Input::shuffled)
+		{
+			std::vector<unsigned> keys(length);
+			for (size_t i = 0; i < length; ++i)
+				keys[i] = scramble(i);
+			std::nth_element(keys.begin(), keys.begin() + length * 3 / 4, keys.end());
+			target = keys[length * 3 / 4];
+		}
+		unsigned target_hash{ hash(target, work) };
+		auto is_target{ [work, target_hash](unsigned val) { return hash(val, work) == target_hash; } };
+
+		run_operation(opt, "count_if", length, input,
+			[&heavy](MyLinkedList<unsigned>& list) { size_t count{ 0 }; for (unsigned val : list.as_const()) count += heavy(val); sink = count; },
+			[&heavy](MyLinkedList<unsigned>& list, size_t threads) { sink = list.parallel_count_if(heavy, threads); });
+		run_operation(opt, "find_if", length, input,
+			[&is_target](MyLinkedList<unsigned>& list) { sink = std::find_if(list.as_const().begin(), list.as_const().end(), is_target) != list.as_const().end(); },
+			[&is_target](MyLinkedList<unsigned>& list, size_t threads) { sink = list.parallel_find_if(is_target, threads) != list.as_const().end(); });
+		run_operation(opt, "transform", length, input,
+			[work](MyLinkedList<unsigned>& list) { for (unsigned& val : list) val = hash(val, work); },
+			[work](MyLinkedList<unsigned>& list, size_t threads) { list.parallel_transform([work](unsigned val) { return hash(val, work); }, threads); });
+		run_operation(opt, "transform_reduce", length, input,
+			[work](MyLinkedList<unsigned>& list) { size_t sum{ 0 }; for (unsigned val : list.as_const()) sum += hash(val, work); sink = sum; },
+			[work](MyLinkedList<unsigned>& list, size_t threads)
+			{ sink = list.parallel_transform_reduce(size_t{ 0 }, [](size_t l, size_t r) { return l + r; }, [work](unsigned val) { return size_t{ hash(val, work) }; }, threads); });
+		run_operation(opt, "remove_if", length, input,
+			[&heavy](MyLinkedList<unsigned>& list) { sink = list.remove_if(heavy); },
+			[&heavy](MyLinkedList<unsigned>& list, size_t threads) { sink = list.parallel_remove_if(heavy, threads); });
+	}
+}
+
+int main(int argc, char** argv) {											//MyListParallelBenchmark [-r repeats] [-f operation] [-t threads]... [-w rounds] [length...]
+	bench::Options opt;
+	std::vector<size_t> lengths;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (!std::strcmp(argv[i], "-r") && i + 1 < argc)
+			opt.repeats = std::atoi(argv[++i]);
+		else if (!std::strcmp(argv[i], "-f") && i + 1 < argc)
+			opt.filter = argv[++i];
+		else if (!std::strcmp(argv[i], "-t") && i + 1 < argc)
+			opt.threads.push_back(std::strtoull(argv[++i], nullptr, 10));
+		else if (!std::strcmp(argv[i], "-w") && i + 1 < argc)
+			opt.work = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+		else
+			lengths.push_back(std::strtoull(argv[i], nullptr, 10));
+	}
+	if (!lengths.empty())
+		opt.lengths = lengths;
+	if (opt.threads.empty())
+		for (size_t threads = 1; threads <= MyListParallel::default_threads(); threads *= 2)
+			opt.threads.push_back(threads);
+	std::printf("%-18s %-10s %10s %8s %12s %9s\n", "operation", "input", "length", "threads", "best ms", "vs serial");
+	for (size_t length : opt.lengths)
+		for (bench::Input input : bench::inputs)
+			bench::run_length(opt, length, input);
+	return 0;
+}
@@ -0,0 +1,101 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#include "MyLinkedList.h"
+#include <list>
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace bench {
+	volatile size_t sink;													//    
+
+	using SharedList = std::shared_ptr<std::list<unsigned>>;				//  shared_ptr -     MyLinkedList
+
+	template <class C> struct Container;
+	template <> struct Container<MyLinkedList<unsigned>> {
+		static constexpr const char* name{ "MyAtomicRefCount" };
+		static MyLinkedList<unsigned> make(size_t length) { MyLinkedList<unsigned> c; for (size_t i = 0; i < length; ++i) c.push_back(static_cast<unsigned>(i)); return c; }
+		static size_t size(const MyLinkedList<unsigned>& c) { return c.size(); }
+	};
+	template <> struct Container<MyLinkedList<unsigned, MyListAllocator, MyPlainRefCount>> {
+		static constexpr const char* name{ "MyPlainRefCount" };
+		static MyLinkedList<unsigned, MyListAllocator, MyPlainRefCount> make(size_t length)
+		{ MyLinkedList<unsigned, MyListAllocator, MyPlainRefCount> c; for (size_t i = 0; i < length; ++i) c.push_back(static_cast<unsigned>(i)); return c; }
+		static size_t size(const MyLinkedList<unsigned, MyListAllocator, MyPlainRefCount>& c) { return c.size(); }
+	};
+	template <> struct Container<SharedList> {
+		static constexpr const char* name{ "shared_ptr<list>" };
+		static SharedList make(size_t length) { SharedList c{ std::make_shared<std::list<unsigned>>() }; for (size_t i = 0; i < length; ++i) c->push_back(static_cast<unsigned>(i)); return c; }
+		static size_t size(const SharedList& c) { return c->size(); }
+	};
+
+	struct Options {
+		std::vector<size_t> counts{ 1000000 };								//    
+		size_t length{ 1000 };												//       
+		int repeats{ 3 };
+		const char* filter{ nullptr };										//    
+	};
+
+	inline bool enabled(const Options& opt, const char* operation, const char* name)
+	{ return !opt.filter || std::strstr(operation, opt.filter) || std::strstr(name, opt.filter); }
+
+	template <class C>
+	void run(const Options& opt, size_t count) {							//copy - count    , assign -     , destroy -  
+		const C first{ Container<C>::make(opt.length) }, second{ Container<C>::make(opt.length) };
+		double copy_ms{ 1e300 }, assign_ms{ 1e300 }, destroy_ms{ 1e300 };
+		for (int r = 0; r < opt.repeats; ++r)
+		{
+			std::vector<C> copies(count);									//        
+			copies.clear();
+			auto start{ std::chrono::steady_clock::now() };
+			for (size_t i = 0; i < count; ++i)
+				copies.emplace_back(first);
+			auto copied{ std::chrono::steady_clock::now() };
+			for (size_t i = 0; i < count; ++i)
+				copies[i] = (i & 1) ? first : second;
+			auto assigned{ std::chrono::steady_clock::now() };
+			sink = Container<C>::size(copies.back());
+			copies.clear();
+			auto destroyed{ std::chrono::steady_clock::now() };
+			copy_ms = std::min(copy_ms, std::chrono::duration<double, std::milli>(copied - start).count());
+			assign_ms = std::min(assign_ms, std::chrono::duration<double, std::milli>(assigned - copied).count());
+			destroy_ms = std::min(destroy_ms, std::chrono::duration<double, std::milli>(destroyed - assigned).count());
+		}
+		const char* operations[]{ "copy", "assign", "destroy" };
+		double results[]{ copy_ms, assign_ms, destroy_ms };
+		for (size_t i = 0; i < 3; ++i)
+			if (enabled(opt, operations[i], Container<C>::name))
+				std::printf("%-10s %-18s %10zu %12.3f %10.2f\n", operations[i], Container<C>::name, count, results[i], results[i] * 1e6 / count);
+	}
+}
+
+int main(int argc, char** argv) {											//MyListRefCountBenchmark [-r repeats] [-f operation] [-l length] [copies...]
+	bench::Options opt;
+	std::vector<size_t> counts;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (!std::strcmp(argv[i], "-r") && i + 1 < argc)
+			opt.repeats = std::atoi(argv[++i]);
+		else if (!std::strcmp(argv[i], "-f") && i + 1 < argc)
+			opt.filter = argv[++i];
+		else if (!std::strcmp(argv[i], "-l") && i + 1 < argc)
+			opt.length = std::strtoull(argv[++i], nullptr, 10);
+		else																//       
+			counts.push_back(std::strtoull(argv[i], nullptr, 10));
+	}
+	if (!counts.empty())
+		opt.counts = counts;
+	std::printf("%-10s %-18s %10s %12s %10s\n", "operation", "policy", "copies", "best ms", "ns/copy");
+	for (size_t count : opt.counts)
+	{
+		bench::run<MyLinkedList<unsigned>>(opt, count);
+		bench::run<MyLinkedList<unsigned, MyListAllocator, MyPlainRefCount>>(opt, count);
+		bench::run<bench::SharedList>(opt, count);
+	}
+	return 0;
+}
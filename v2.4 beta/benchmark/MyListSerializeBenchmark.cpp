@@ -0,0 +1,110 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#include "MyLinkedList.h"
+#include <list>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace bench {
+	volatile size_t sink;													//    
+
+	struct Record {															// :  ,    
+		unsigned long long time;
+		unsigned id;
+		float value;
+	};
+
+	struct Options {
+		std::vector<size_t> lengths{ 100000, 1000000 };
+		int repeats{ 3 };
+		const char* filter{ nullptr };										//    
+	};
+
+	inline bool enabled(const Options& opt, const char* operation, const char* method)
+	{ return !opt.filter || std::strstr(operation, opt.filter) || std::strstr(method, opt.filter); }
+
+	inline Record make_record(size_t i) noexcept { return Record{ i * 1000ull, static_cast<unsigned>(i), static_cast<float>(i) * 0.5f }; }
+
+	template <class Setup, class Run>
+	double measure(const Options& opt, Setup setup, Run run) {				//    ,   
+		double best{ 1e300 };
+		for (int r = 0; r < opt.repeats; ++r)
+		{
+			std::stringstream stream;
+			setup(stream);
+			auto start{ std::chrono::steady_clock::now() };
+			run(stream);
+			best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+		}
+		return best;
+	}
+
+	inline void report(const Options& opt, const char* operation, const char* method, size_t length, double ms, double baseline) {
+		if (enabled(opt, operation, method))
+			std::printf("%-6s %-24s %10zu %12.3f %10.2f %8.2fx\n", operation, method, length, ms, ms * 1e6 / length, baseline / ms);
+	}
+
+	void run_length(const Options& opt, size_t length) {					//      std::list
+		MyLinkedList<Record> source;
+		std::list<Record> std_source;
+		for (size_t i = 0; i < length; ++i)
+		{
+			source.push_back(make_record(i));
+			std_source.push_back(make_record(i));
+		}
+		auto nothing{ [](std::stringstream&) {} };
+		auto write_elementwise{ [](std::stringstream& stream, const auto& c) {
+			size_t count{ c.size() };
+			stream.write(reinterpret_cast<const char*>(&count), sizeof(count));
+			for (const Record& val : c)
+				stream.write(reinterpret_cast<const char*>(&val), sizeof(val));
+		} };
+		auto read_elementwise{ [](std::stringstream& stream, auto& c) {
+			size_t count{ 0 };
+			stream.read(reinterpret_cast<char*>(&count), sizeof(count));
+			Record val;
+			for (size_t i = 0; i < count && stream.read(reinterpret_cast<char*>(&val), sizeof(val)); ++i)
+				c.push_back(val);
+			sink = c.size();
+		} };
+
+		double baseline{ measure(opt, nothing, [&](std::stringstream& stream) { write_elementwise(stream, std_source); }) };
+		report(opt, "save", "std::list elementwise", length, baseline, baseline);
+		report(opt, "save", "MyLinkedList elementwise", length, measure(opt, nothing, [&](std::stringstream& stream) { write_elementwise(stream, source.as_const()); }), baseline);
+		report(opt, "save", "MyLinkedList save", length, measure(opt, nothing, [&](std::stringstream& stream) { sink = source.save(stream); }), baseline);
+
+		auto image{ [&](std::stringstream& stream) { write_elementwise(stream, std_source); } };
+		auto list_image{ [&](std::stringstream& stream) { source.save(stream); } };
+		baseline = measure(opt, image, [&](std::stringstream& stream) { std::list<Record> c; read_elementwise(stream, c); });
+		report(opt, "load", "std::list elementwise", length, baseline, baseline);
+		report(opt, "load", "MyLinkedList elementwise", length, measure(opt, image, [&](std::stringstream& stream) { MyLinkedList<Record> c; read_elementwise(stream, c); }), baseline);
+		report(opt, "load", "MyLinkedList load", length, measure(opt, list_image, [&](std::stringstream& stream) { MyLinkedList<Record> c; sink = c.load(stream); }), baseline);
+	}
+}
+
+int main(int argc, char** argv) {											//MyListSerializeBenchmark [-r repeats] [-f operation] [length...]
+	bench::Options opt;
+	std::vector<size_t> lengths;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (!std::strcmp(argv[i], "-r") && i + 1 < argc)
+			opt.repeats = std::atoi(argv[++i]);
+		else if (!std::strcmp(argv[i], "-f") && i + 1 < argc)
+			opt.filter = argv[++i];
+		else
+			lengths.push_back(std::strtoull(argv[i], nullptr, 10));
+	}
+	if (!lengths.empty())
+		opt.lengths = lengths;
+	std::printf("%-6s %-24s %10s %12s %10s %9s\n", "op", "method", "length", "best ms", "ns/elem", "vs list");
+	for (size_t length : opt.lengths)
+		bench::run_length(opt, length);
+	return 0;
+}
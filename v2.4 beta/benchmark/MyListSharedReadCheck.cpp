@@ -0,0 +1,61 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#define MYLIST_STATISTICS													//     
+#include "MyLinkedList.h"
+#include "MyUnrolledList.h"
+#include <cstdio>
+
+namespace check {
+	volatile size_t sink;													//    
+	size_t pages_allocated{ 0 };
+
+	void count_page(const void*, size_t, void*) { ++pages_allocated; }
+
+	template <class Run>
+	size_t pages_during(Run run) {											//     run
+		pages_allocated = 0;
+		MyListStatistics::reset_detaches();
+		run();
+		return pages_allocated + MyListStatistics::detaches().count;		//      
+	}
+
+	int failures{ 0 };
+
+	inline void expect(const char* name, size_t pages, bool allocates) {	//allocates -  : ,   
+		bool ok{ allocates ? pages != 0 : pages == 0 };
+		std::printf("%-36s %8zu  %s\n", name, pages, ok ? "ok" : "FAILED");
+		failures += !ok;
+	}
+
+	template <class List>
+	void run(const char* name) {
+		List origin;
+		for (int i = 0; i < 100000; ++i)
+			origin.push_back(i);
+		List copy{ origin };												//    origin
+		char row[64];
+		std::snprintf(row, sizeof(row), "%s range-for as_const", name);
+		expect(row, pages_during([&] { size_t sum{ 0 }; for (int val : copy.as_const()) sum += static_cast<unsigned>(val); sink = sum; }), false);
+		std::snprintf(row, sizeof(row), "%s const find", name);
+		expect(row, pages_during([&] { sink = copy.as_const().find(-1) == copy.cend(); }), false);
+		std::snprintf(row, sizeof(row), "%s removeOne missing", name);
+		expect(row, pages_during([&] { sink = copy.removeOne(-1); }), false);
+		std::snprintf(row, sizeof(row), "%s remove_if no match", name);
+		expect(row, pages_during([&] { sink = copy.remove_if([](int val) { return val < 0; }); }), false);
+		std::snprintf(row, sizeof(row), "%s still shared", name);
+		expect(row, copy.is_shared() ? 0 : 1, false);
+		std::snprintf(row, sizeof(row), "%s range-for non-const", name);
+		expect(row, pages_during([&] { size_t sum{ 0 }; for (int& val : copy) sum += static_cast<unsigned>(val); sink = sum; }), true);
+	}
+}
+
+int main() {																//MyListSharedReadCheck.    ,      
+	MyListStatistics::Hooks hooks;
+	hooks.on_page_allocated = check::count_page;
+	MyListStatistics::set_hooks(hooks);
+	std::printf("%-36s %8s\n", "read loop over a shared list", "pages");
+	check::run<MyLinkedList<int>>("MyLinkedList");
+	check::run<MyUnrolledList<int>>("MyUnrolledList");
+	return check::failures ? 1 : 0;
+}
@@ -0,0 +1,105 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#include "MyLinkedList.h"
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace bench {
+	inline unsigned scramble(size_t i) noexcept { return static_cast<unsigned>(i * 2654435761u) >> 4; }
+
+	enum class Input { random, sorted, nearly_sorted, reversed };
+	constexpr Input inputs[]{ Input::random, Input::sorted, Input::nearly_sorted, Input::reversed };
+	inline const char* input_name(Input input) noexcept {
+		switch (input)
+		{
+		case Input::random: return "random";
+		case Input::sorted: return "sorted";
+		case Input::nearly_sorted: return "nearly_sorted";
+		default: return "reversed";
+		}
+	}
+
+	struct Options {
+		std::vector<size_t> lengths{ 1000000, 10000000 };
+		std::vector<size_t> threads;											//  - 1, 2, 4...   
+		int repeats{ 3 };
+		const char* filter{ nullptr };										//  
+	};
+
+	template <class Setup, class Run>
+	double measure(const Options& opt, Setup setup, Run run) {				//    ,   
+		double best{ 1e300 };
+		for (int r = 0; r < opt.repeats; ++r)
+		{
+			MyLinkedList<unsigned> list;
+			setup(list);
+			auto start{ std::chrono::steady_clock::now() };
+			run(list);
+			std::chrono::duration<double, std::milli> elapsed{ std::chrono::steady_clock::now() - start };
+			best = std::min(best, elapsed.count());
+		}
+		return best;
+	}
+
+	inline bool enabled(const Options& opt, const char* operation) { return !opt.filter || std::strstr(operation, opt.filter); }
+
+	inline void report(const char* operation, Input input, size_t length, size_t threads, double ms, double baseline) {
+		std::printf("%-18s %-14s %10zu %8zu %12.3f %8.2fx\n", operation, input_name(input), length, threads, ms, baseline / ms);
+	}
+
+	inline void fill(MyLinkedList<unsigned>& list, size_t length, Input input) {
+		for (size_t i = 0; i < length; ++i)
+			switch (input)
+			{
+			case Input::random: list.push_back(scramble(i)); break;
+			case Input::sorted: list.push_back(static_cast<unsigned>(i)); break;
+			case Input::nearly_sorted: list.push_back(scramble(i) % 100 ? static_cast<unsigned>(i) : scramble(i) % length); break;	//1%     
+			default: list.push_back(static_cast<unsigned>(length - i)); break;
+			}
+	}
+
+	void run_length(const Options& opt, size_t length, Input input) {
+		auto setup{ [length, input](MyLinkedList<unsigned>& list) { fill(list, length, input); } };
+		double baseline{ measure(opt, setup, [](MyLinkedList<unsigned>& list) { list.sort(); }) };	//     sort()
+		if (enabled(opt, "sort"))
+			report("sort", input, length, 1, baseline, baseline);
+		if (enabled(opt, "adaptive_sort"))
+			report("adaptive_sort", input, length, 1, measure(opt, setup, [](MyLinkedList<unsigned>& list) { list.adaptive_sort(); }), baseline);
+		if (enabled(opt, "radix_sort"))
+			report("radix_sort", input, length, 1, measure(opt, setup, [](MyLinkedList<unsigned>& list) { list.radix_sort(); }), baseline);
+		if (enabled(opt, "parallel_sort"))
+			for (size_t threads : opt.threads)
+				report("parallel_sort", input, length, threads, measure(opt, setup, [threads](MyLinkedList<unsigned>& list) { list.sort(threads, std::less<>()); }), baseline);
+	}
+}
+
+int main(int argc, char** argv) {											//MyListSortBenchmark [-r repeats] [-f operation] [-t threads]... [length...]
+	bench::Options opt;
+	std::vector<size_t> lengths;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (!std::strcmp(argv[i], "-r") && i + 1 < argc)
+			opt.repeats = std::atoi(argv[++i]);
+		else if (!std::strcmp(argv[i], "-f") && i + 1 < argc)
+			opt.filter = argv[++i];
+		else if (!std::strcmp(argv[i], "-t") && i + 1 < argc)
+			opt.threads.push_back(std::strtoull(argv[++i], nullptr, 10));
+		else
+			lengths.push_back(std::strtoull(argv[i], nullptr, 10));
+	}
+	if (!lengths.empty())
+		opt.lengths = lengths;
+	if (opt.threads.empty())
+		for (size_t threads = 1; threads <= MyListParallel::default_threads(); threads *= 2)
+			opt.threads.push_back(threads);
+	std::printf("%-18s %-14s %10s %8s %12s %9s\n", "operation", "input", "length", "threads", "best ms", "vs sort");
+	for (size_t length : opt.lengths)
+		for (bench::Input input : bench::inputs)
+			bench::run_length(opt, length, input);
+	return 0;
+}
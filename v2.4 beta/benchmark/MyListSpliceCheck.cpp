@@ -0,0 +1,71 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#include "MyLinkedList.h"
+#include <list>
+#include <iterator>
+#include <cstdio>
+
+namespace check {
+	using List = MyLinkedList<int>;
+	constexpr int length{ 5 };
+
+	int failures{ 0 };
+
+	bool same(const List& list, const std::list<int>& expected) {			//     : ,   ,   
+		if (list.size() != expected.size())
+			return false;
+		auto cur{ list.cbegin() };
+		for (int val : expected)
+		{
+			if (cur == list.cend() || *cur != val)
+				return false;
+			++cur;
+		}
+		if (cur != list.cend())
+			return false;
+		auto back{ expected.crbegin() };
+		for (size_t i = 0; i < expected.size(); ++i, ++back)
+		{
+			--cur;
+			if (*cur != *back)
+				return false;
+		}
+		return cur == list.cbegin();
+	}
+
+	template <class Make, class Move>
+	void run(const char* name, Make make, Move move) {						//   (before, target)    length 
+		int bad{ 0 };
+		for (int before = 0; before <= length; ++before)
+			for (int target = 0; target < length; ++target)
+			{
+				List list{ make() };
+				List copy{ list };											// list      
+				std::list<int> expected{ list.cbegin(), list.cend() };
+				move(list, std::next(list.begin(), before), std::next(list.begin(), target));
+				if (before != target)										// std::list before == first    ,   -   
+					move(expected, std::next(expected.begin(), before), std::next(expected.begin(), target));
+				bad += !same(list, expected) || !same(copy, std::list<int>{ copy.cbegin(), copy.cend() }) || copy.size() != static_cast<size_t>(length);
+			}
+		std::printf("%-36s %8d  %s\n", name, bad, bad ? "FAILED" : "ok");
+		failures += bad != 0;
+	}
+}
+
+int main() {																//MyListSpliceCheck.    ,  splice    
+	check::List::Family family;
+	auto own{ [] { check::List list; for (int i = 0; i < check::length; ++i) list.push_back(i); return list; } };
+	auto shared{ [&family] { check::List list{ family }; for (int i = 0; i < check::length; ++i) list.push_back(i); return list; } };
+	auto one{ [](auto& list, auto before, auto target) { list.splice(before, list, target); } };
+	auto range{ [](auto& list, auto before, auto first) {					// [first; end): before  ,   first,  
+		if (before == first || before == list.end() || std::distance(list.begin(), before) < std::distance(list.begin(), first))
+			list.splice(before, list, first, list.end());
+	} };
+	std::printf("%-36s %8s\n", "splice within one list", "broken");
+	check::run("single node, own storage", own, one);
+	check::run("single node, Family", shared, one);
+	check::run("range to end, own storage", own, range);
+	check::run("range to end, Family", shared, range);
+	return check::failures ? 1 : 0;
+}
@@ -0,0 +1,151 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#include "MyLruCache.h"
+#include <list>
+#include <unordered_map>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+namespace bench {
+	volatile size_t sink;													//    
+
+	class MapListCache {													// :    std::list,  -  unordered_map 
+	private:
+		using Entry = std::pair<size_t, size_t>;
+		size_t capacity;
+		std::list<Entry> order;
+		std::unordered_map<size_t, std::list<Entry>::iterator> index;
+	public:
+		explicit MapListCache(size_t cache_capacity) : capacity{ cache_capacity } { index.reserve(cache_capacity); }
+		size_t* get(size_t key) {
+			auto found{ index.find(key) };
+			if (found == index.end())
+				return nullptr;
+			order.splice(order.begin(), order, found->second);
+			return &found->second->second;
+		}
+		void put(size_t key, size_t value) {
+			auto found{ index.find(key) };
+			if (found != index.end())
+			{
+				found->second->second = value;
+				order.splice(order.begin(), order, found->second);
+				return;
+			}
+			if (order.size() == capacity)
+			{
+				index.erase(order.back().first);
+				order.pop_back();
+			}
+			order.emplace_front(key, value);
+			index.emplace(key, order.begin());
+		}
+	};
+
+	template <class C> struct Container;
+	template <> struct Container<MyLruCache<size_t, size_t>> {
+		static constexpr const char* name{ "MyLruCache" };
+		static size_t bytes(const MyLruCache<size_t, size_t>& c) { return c.allocator_statistics().allocated_blocks * 48; }	// -   , , ,   
+	};
+	template <> struct Container<MapListCache> {
+		static constexpr const char* name{ "unordered_map+list" };
+		static size_t bytes(const MapListCache&) { return 0; }				//  std::list  std::unordered_map   -  
+	};
+
+	struct Options {
+		std::vector<size_t> capacities{ 1000, 100000, 1000000 };
+		size_t operations{ 4000000 };
+		int repeats{ 3 };
+		const char* filter{ nullptr };										//    
+	};
+
+	inline bool enabled(const Options& opt, const char* workload, const char* name)
+	{ return !opt.filter || std::strstr(workload, opt.filter) || std::strstr(name, opt.filter); }
+
+	std::vector<size_t> make_keys(const char* workload, size_t capacity, size_t count) {	//uniform -    , zipf -     
+		std::mt19937_64 rng{ 42 };
+		std::vector<size_t> keys(count);
+		if (!std::strcmp(workload, "uniform"))
+		{
+			std::uniform_int_distribution<size_t> dist{ 0, 2 * capacity - 1 };
+			for (size_t& key : keys)
+				key = dist(rng);
+			return keys;
+		}
+		size_t range{ 10 * capacity };										//Zipf(1)    :  ~ range^u
+		std::uniform_real_distribution<double> dist{ 0.0, 1.0 };
+		for (size_t& key : keys)
+			key = (static_cast<size_t>(std::pow(static_cast<double>(range), dist(rng))) - 1) * 0x9E3779B97F4A7C15ull;	// ,      
+		return keys;
+	}
+
+	template <class C>
+	void run(const Options& opt, const char* workload, size_t capacity, const std::vector<size_t>& keys) {	//get,   - put
+		if (!enabled(opt, workload, Container<C>::name))
+			return;
+		double best_ms{ 1e300 };
+		size_t hits{ 0 }, filled_bytes{ 0 }, evicting_bytes{ 0 };			//      
+		for (int r = 0; r < opt.repeats; ++r)
+		{
+			C cache(capacity);
+			for (size_t i = 0; i < capacity; ++i)							//   :     
+				cache.put(~i, i);
+			filled_bytes = Container<C>::bytes(cache);
+			hits = 0;
+			auto start{ std::chrono::steady_clock::now() };
+			for (size_t key : keys)
+			{
+				if (size_t* value = cache.get(key))
+				{
+					sink = *value;
+					++hits;
+				}
+				else
+					cache.put(key, key);
+			}
+			best_ms = std::min(best_ms, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+			evicting_bytes = Container<C>::bytes(cache);
+		}
+		char filled[24]{ "-" }, evicting[24]{ "-" };
+		if (filled_bytes)
+		{
+			std::snprintf(filled, sizeof(filled), "%zu", filled_bytes);
+			std::snprintf(evicting, sizeof(evicting), "%zu", evicting_bytes);
+		}
+		std::printf("%-8s %-20s %10zu %12.3f %10.2f %8.1f %12s %12s\n", workload, Container<C>::name, capacity, best_ms, best_ms * 1e6 / keys.size(), 100.0 * hits / keys.size(), filled, evicting);
+	}
+}
+
+int main(int argc, char** argv) {											//MyLruCacheBenchmark [-r repeats] [-f workload] [-n operations] [capacities...]
+	bench::Options opt;
+	std::vector<size_t> capacities;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (!std::strcmp(argv[i], "-r") && i + 1 < argc)
+			opt.repeats = std::atoi(argv[++i]);
+		else if (!std::strcmp(argv[i], "-f") && i + 1 < argc)
+			opt.filter = argv[++i];
+		else if (!std::strcmp(argv[i], "-n") && i + 1 < argc)
+			opt.operations = std::strtoull(argv[++i], nullptr, 10);
+		else
+			capacities.push_back(std::strtoull(argv[i], nullptr, 10));
+	}
+	if (!capacities.empty())
+		opt.capacities = capacities;
+	std::printf("%-8s %-20s %10s %12s %10s %8s %12s %12s\n", "workload", "cache", "capacity", "best ms", "ns/op", "hit %", "pool filled", "pool evicted");
+	for (size_t capacity : opt.capacities)
+		for (const char* workload : { "uniform", "zipf" })
+		{
+			std::vector<size_t> keys{ bench::make_keys(workload, capacity, opt.operations) };
+			bench::run<MyLruCache<size_t, size_t>>(opt, workload, capacity, keys);
+			bench::run<bench::MapListCache>(opt, workload, capacity, keys);
+		}
+	return 0;
+}
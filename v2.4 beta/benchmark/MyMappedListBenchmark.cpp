@@ -0,0 +1,89 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#include "MyMappedList.h"
+#include "MyLinkedList.h"
+#include <vector>
+#include <string>
+#include <fstream>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace bench {
+	volatile size_t sink;													//    
+
+	struct Options {
+		std::vector<size_t> lengths{ 100000, 1000000, 10000000 };
+		int repeats{ 3 };
+		const char* filter{ nullptr };										//  
+		std::string path{ "MyMappedListBenchmark.tmp" };					//      
+	};
+
+	inline bool enabled(const Options& opt, const char* operation) { return !opt.filter || std::strstr(operation, opt.filter); }
+
+	template <class Run>
+	double measure(const Options& opt, Run run) {							//    .     -   
+		double best{ 1e300 };
+		for (int r = 0; r < opt.repeats; ++r)
+		{
+			auto start{ std::chrono::steady_clock::now() };
+			run();
+			best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+		}
+		return best;
+	}
+
+	inline void report(const Options& opt, const char* operation, const char* method, size_t length, double ms, double baseline) {
+		if (enabled(opt, operation))
+			std::printf("%-10s %-14s %10zu %12.3f %10.2f %9.2fx\n", operation, method, length, ms, ms * 1e6 / length, baseline / ms);
+	}
+
+	void run_length(const Options& opt, size_t length) {					//    MyLinkedList  
+		std::string image{ opt.path + ".image" }, mapped{ opt.path + ".mapped" };
+		double baseline{ measure(opt, [&] { MyLinkedList<unsigned> list; for (size_t i = 0; i < length; ++i) list.push_back(static_cast<unsigned>(i)); std::ofstream out(image, std::ios::binary); sink = list.save(out); }) };
+		report(opt, "build", "MyLinkedList", length, baseline, baseline);
+		report(opt, "build", "MyMappedList", length, measure(opt, [&] {
+			MyMappedList<unsigned> list(mapped.c_str(), MyMappedList<unsigned>::Mode::create);
+			list.reserve(length);
+			for (size_t i = 0; i < length; ++i)
+				list.push_back(static_cast<unsigned>(i));
+			sink = list.size();												//       
+		}), baseline);
+
+		baseline = measure(opt, [&] { MyLinkedList<unsigned> list; std::ifstream in(image, std::ios::binary); list.load(in); sink = list.back(); });
+		report(opt, "open", "MyLinkedList", length, baseline, baseline);
+		report(opt, "open", "MyMappedList", length, measure(opt, [&] { MyMappedList<unsigned> list(mapped.c_str(), MyMappedList<unsigned>::Mode::read_only); sink = list.back(); }), baseline);
+
+		auto sum{ [](const auto& list) { size_t total{ 0 }; for (unsigned val : list) total += val; return total; } };
+		baseline = measure(opt, [&] { MyLinkedList<unsigned> list; std::ifstream in(image, std::ios::binary); list.load(in); sink = sum(list.as_const()); });
+		report(opt, "open+scan", "MyLinkedList", length, baseline, baseline);
+		report(opt, "open+scan", "MyMappedList", length, measure(opt, [&] { MyMappedList<unsigned> list(mapped.c_str(), MyMappedList<unsigned>::Mode::read_only); sink = sum(list.as_const()); }), baseline);
+		std::remove(image.c_str());
+		std::remove(mapped.c_str());
+	}
+}
+
+int main(int argc, char** argv) {											//MyMappedListBenchmark [-r repeats] [-f operation] [-p path] [length...]
+	bench::Options opt;
+	std::vector<size_t> lengths;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (!std::strcmp(argv[i], "-r") && i + 1 < argc)
+			opt.repeats = std::atoi(argv[++i]);
+		else if (!std::strcmp(argv[i], "-f") && i + 1 < argc)
+			opt.filter = argv[++i];
+		else if (!std::strcmp(argv[i], "-p") && i + 1 < argc)
+			opt.path = argv[++i];
+		else
+			lengths.push_back(std::strtoull(argv[i], nullptr, 10));
+	}
+	if (!lengths.empty())
+		opt.lengths = lengths;
+	std::printf("%-10s %-14s %10s %12s %10s %10s\n", "operation", "list", "length", "best ms", "ns/elem", "vs load");
+	for (size_t length : opt.lengths)
+		bench::run_length(opt, length);
+	return 0;
+}
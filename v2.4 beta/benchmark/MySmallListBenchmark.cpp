@@ -0,0 +1,106 @@
+/*********************
+Dmitry Bolshakov, 2020
+*********************/
+#include "MySmallLinkedList.h"
+#include <list>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace bench {
+	size_t heap_bytes{ 0 };													// ,   MyNewPageSource
+	size_t heap_calls{ 0 };
+	volatile size_t sink;													//    
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+#define MYBENCH_NOINLINE __attribute__((noinline))
+#else
+#define MYBENCH_NOINLINE
+#endif
+
+void* operator new(size_t bytes) {											// :     
+	bench::heap_bytes += bytes;
+	++bench::heap_calls;
+	if (void* ptr = std::malloc(bytes ? bytes : 1))
+		return ptr;
+	throw std::bad_alloc();
+}
+void* operator new[](size_t bytes) { return ::operator new(bytes); }		//     
+MYBENCH_NOINLINE void operator delete(void* ptr) noexcept { std::free(ptr); }	// :  GCC  free    operator new
+void operator delete(void* ptr, size_t) noexcept { ::operator delete(ptr); }	//  delete   ,  operator new
+void operator delete[](void* ptr) noexcept { ::operator delete(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { ::operator delete(ptr); }
+
+namespace bench {
+	template <class C> struct Container;
+	template <class T> struct Container<MyLinkedList<T>> { static constexpr const char* name{ "MyLinkedList" }; };
+	template <class T, size_t N> struct Container<MySmallLinkedList<T, N>> { static constexpr const char* name{ "MySmallLinkedList" }; };
+	template <class T> struct Container<std::list<T>> { static constexpr const char* name{ "std::list" }; };
+	template <class T> struct Container<std::vector<T>> { static constexpr const char* name{ "std::vector" }; };
+
+	struct Options {
+		std::vector<size_t> counts{ 100000 };									//   
+		std::vector<size_t> lengths{ 0, 1, 2, 4, 8 };
+		int repeats{ 3 };
+		const char* filter{ nullptr };										//  
+	};
+
+	template <class C>
+	void run(const Options& opt, size_t count, size_t length) {				// count   length : ,    new  
+		if (opt.filter && !std::strstr(Container<C>::name, opt.filter))
+			return;
+		double best{ 1e300 };
+		size_t bytes{ 0 }, calls{ 0 };
+		for (int r = 0; r < opt.repeats; ++r)
+		{
+			std::vector<C> lists(count);
+			size_t start_bytes{ heap_bytes }, start_calls{ heap_calls };
+			auto start{ std::chrono::steady_clock::now() };
+			for (C& c : lists)
+				for (size_t i = 0; i < length; ++i)
+					c.push_back(static_cast<unsigned>(i));
+			std::chrono::duration<double, std::milli> elapsed{ std::chrono::steady_clock::now() - start };
+			best = std::min(best, elapsed.count());
+			bytes = heap_bytes - start_bytes;
+			calls = heap_calls - start_calls;
+			sink = lists.back().size();
+		}
+		std::printf("%-18s %8zu %8zu %10zu %12.1f %10.2f %12.3f\n", Container<C>::name, count, length, sizeof(C),
+			static_cast<double>(bytes) / count, static_cast<double>(calls) / count, best);
+	}
+}
+
+int main(int argc, char** argv) {											//MySmallListBenchmark [-r repeats] [-f container] [-l length]... [lists...]
+	bench::Options opt;
+	std::vector<size_t> lengths, counts;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (!std::strcmp(argv[i], "-r") && i + 1 < argc)
+			opt.repeats = std::atoi(argv[++i]);
+		else if (!std::strcmp(argv[i], "-f") && i + 1 < argc)
+			opt.filter = argv[++i];
+		else if (!std::strcmp(argv[i], "-l") && i + 1 < argc)
+			lengths.push_back(std::strtoull(argv[++i], nullptr, 10));
+		else																//       
+			counts.push_back(std::strtoull(argv[i], nullptr, 10));
+	}
+	if (!lengths.empty())
+		opt.lengths = lengths;
+	if (!counts.empty())
+		opt.counts = counts;
+	std::printf("%-18s %8s %8s %10s %12s %10s %12s\n", "container", "lists", "length", "sizeof", "heap B/list", "new/list", "best ms");
+	for (size_t count : opt.counts)
+		for (size_t length : opt.lengths)
+		{
+			bench::run<MyLinkedList<unsigned>>(opt, count, length);
+			bench::run<MySmallLinkedList<unsigned, 4>>(opt, count, length);
+			bench::run<std::list<unsigned>>(opt, count, length);
+			bench::run<std::vector<unsigned>>(opt, count, length);
+		}
+	return 0;
+}